@@ -26,10 +26,9 @@
 #include <Arduino.h>
 #include "Adafruit_RA8875.h"
 #include "PanelBase.h"
+#include "Layout.h"
+#include "DisplayList.h"
 
-#define BARO_WIDTH 289
-#define BARO_HEIGTH 170
-#define BARO_XTREME_YOFFSET 115
 #define BARO_CLICK_MIN_X 1
 #define BARO_CLICK_MIN_Y (1)
 #define BARO_CLICK_MAX_X (BARO_WIDTH-1)
@@ -44,12 +43,13 @@
 
 #define HPA_HG_CONVERSION (33.86389)
 
-class BaroPanel: virtual public PanelBase {
+class BaroPanel: public PanelBase {
   public:
     BaroPanel(Adafruit_RA8875 *tft, uint16_t x, uint16_t y);
     void draw(void);
+    void reportDamage(void);
     void setPressure(float baro);
-    bool isClicked(uint16_t x, uint16_t y) override;
+    bool isClicked(uint16_t x, uint16_t y);
 
   private:
     Adafruit_RA8875 *tft;
@@ -66,6 +66,7 @@ class BaroPanel: virtual public PanelBase {
     enum Extremes highlow;
     bool baroDirty;
     bool borderDirty;
+    DisplayList valueList;      // Value box, redrawn per changed character
     bool extremeDirty;
 
     void drawExtremes(void);
@@ -0,0 +1,114 @@
+/**
+ *  @filename   :   DisplayList.h
+ *  @brief      :   ESP32 Ecowitt Weather Station Console, retained display list
+ *
+ *  @author     :   Kevin Kessler
+ *
+ * Copyright (C) 2024 Kevin Kessler
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef INCLUDE_DISPLAYLIST_H_
+#define INCLUDE_DISPLAYLIST_H_
+
+#include <Arduino.h>
+#include "Adafruit_RA8875.h"
+#include "bitmaps.h"
+
+#define DL_MAX_OPS 4
+#define DL_MAX_TEXT 12
+#define DL_MAX_DIRTY 8
+
+#define DL_OP_TEXT 0
+#define DL_OP_BITMAP 1
+#define DL_OP_RECT 2
+#define DL_OP_ASSET 3
+
+struct DisplayOp {
+  uint8_t type;
+  uint16_t x;             // Bounds, the value box for text
+  uint16_t y;
+  uint16_t w;
+  uint16_t h;
+  uint16_t textx;         // Text cell origin
+  uint16_t texty;
+  uint16_t color;         // Rect fill
+  const uint8_t *bitmap;
+  const Asset *asset;
+  char text[DL_MAX_TEXT];
+};
+
+struct DisplayListStats {
+  uint16_t opsDrawn;
+  uint16_t opsSkipped;
+  uint32_t pixels;        // Pixels rewritten by text ops
+};
+
+/*
+ * A panel region rebuilt every frame as a short list of ops.  end() compares the list with
+ * the one from the previous frame and draws only what changed: text ops are diffed per
+ * character and only the changed cells are recomposed, anything overlapping a region that
+ * was rewritten is drawn again.  Ops draw in the order they were emitted, so emit a text
+ * op before the bitmaps that sit on top of its box.  With the atlas renderer an asset
+ * emitted after a text op and inside its box is composited with the text instead.
+ */
+class DisplayList {
+  public:
+    DisplayList(Adafruit_RA8875 *tft);
+    void begin(void);
+    void text(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t textx, uint16_t texty, const char *s);
+    void bitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t *bitmap);
+    void rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color);
+    void asset(uint16_t x, uint16_t y, const Asset *asset);
+    void end(void);
+    void invalidate(void);
+
+    static const DisplayListStats *getStats(void);
+    static void resetStats(void);
+
+  private:
+    struct Region {
+      uint16_t x;
+      uint16_t y;
+      uint16_t w;
+      uint16_t h;
+    };
+
+    Adafruit_RA8875 *tft;
+    DisplayOp ops[2][DL_MAX_OPS];
+    uint8_t count[2];
+    uint8_t current;
+    bool valid;
+
+    Region dirty[DL_MAX_DIRTY];
+    uint8_t dirtyCount;
+    bool allDirty;
+
+    static DisplayListStats stats;
+
+    DisplayOp *add(uint8_t type, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+    bool sameOp(const DisplayOp *a, const DisplayOp *b);
+    bool textSpan(const DisplayOp *prev, const DisplayOp *op, Region *span);
+    void addDirty(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+    bool clipToOp(const DisplayOp *op, const Region *r, Region *clip);
+    bool overlapsDirty(const DisplayOp *op);
+    bool coveredByText(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+    bool insideBox(const DisplayOp *box, const DisplayOp *op);
+    bool composedIntoText(uint8_t index);
+    void drawText(const DisplayOp *op, const Region *r);
+    void drawOp(const DisplayOp *op);
+};
+
+#endif /* INCLUDE_DISPLAYLIST_H_ */
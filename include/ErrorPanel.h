@@ -28,17 +28,47 @@
 
 #define HEADER_HEIGTH 10
 
+#define ERROR_QUEUE_LEN 6
+#define ERROR_MESSAGE_LEN 70
+#define ERROR_REDRAW_MS 1000      // The bar is repainted at most this often
+#define ERROR_ROTATE_MS 4000      // Time each active error of the top severity is shown
+#define ERROR_EXPIRE_MS 60000     // A repeating error not reported again for this long goes away
+
+struct ErrorEntry {
+  char message[ERROR_MESSAGE_LEN];
+  uint8_t severity;
+  uint16_t count;             // Times reported since it became active
+  uint32_t lastSeen;
+};
+
+/*
+ * Active errors are kept in a small queue, a message that is already there only refreshes
+ * its entry.  update() expires repeating errors that stopped being reported, critical and
+ * one shot errors stay until clearMessage().  It rotates the bar through the active errors
+ * of the highest severity, repainting only when what is shown changes and no more often
+ * than ERROR_REDRAW_MS.  A new critical error is shown straight away, the callers of those
+ * often block.
+ */
 class ErrorPanel {
   public:
     ErrorPanel(Adafruit_RA8875 *tft);
     void draw(void);
-    void setMessage(const char *error) ;
+    void update(void);
+    void setMessage(const char *error, uint8_t severity);
     void clearMessage(void);
 
   private:
     Adafruit_RA8875 *tft;
-    char messageBuffer[70];
-    bool messageExists;
+    ErrorEntry queue[ERROR_QUEUE_LEN];
+    uint8_t queueCount;
+    int8_t shown;               // Entry on the bar, -1 when clear
+    char drawnMessage[ERROR_MESSAGE_LEN];   // Empty while the bar shows the background
+    uint32_t lastDraw;
+    uint32_t lastRotate;
+    int8_t findMessage(const char *error);
+    void removeEntry(uint8_t n);
+    void expire(void);
+    void pickShown(bool rotate);
 };
 
 #endif /* INCLUDE_ERRORPANEL_H_ */
\ No newline at end of file
@@ -29,19 +29,32 @@
 
 #define HEADER_HEIGTH 10
 
-class HeaderPanel: virtual public PanelBase {
+class HeaderPanel: public PanelBase {
   public:
     HeaderPanel(Adafruit_RA8875 *tft);
+    void begin(void);
     void draw(void);
     void setBatteryLevel(float level);
-    bool isClicked(uint16_t x, uint16_t y) override;
+    void update(void);
+    bool isClicked(uint16_t x, uint16_t y);
     
   private:
     Adafruit_RA8875 *tft;
     char timeBuffer[6];
     char dateBuffer[9];
+    char drawnTime[6];      // What is on screen, only the characters that differ are redrawn
+    char drawnDate[9];
     float battery_level;
+    int16_t drawnBattery;   // Gauge offset on screen, -1 before the first draw
+    uint16_t drawnBatteryColor;
+    time_t lastMinute;
+    bool barDirty;
     void fillDateTimeBuffers(void);
+    void drawTime(void);
+    void drawBattery(void);
+    uint8_t batteryOffset(void);
+    uint16_t batteryColor(void);
+    bool batteryChanged(void);
 };
 
 #endif /* INCLUDE_HEADERPANEL_H_ */
\ No newline at end of file
@@ -26,25 +26,24 @@
 #include <Arduino.h>
 #include "Adafruit_RA8875.h"
 #include "PanelBase.h"
+#include "Layout.h"
 
-#define HUM_WIDTH 250
-#define HUM_HEIGTH 190
-#define HUM_XTREME_YOFFSET 115
 #define HUM_CLICK_MIN_X 1
 #define HUM_CLICK_MIN_Y (1)
 #define HUM_CLICK_MAX_X (HUM_WIDTH-1)
-#define HUM_CLICK_MAX_Y (50) 
+#define HUM_CLICK_MAX_Y (XTREME_HEIGTH+1)     // Below HUM_XTREME_YOFFSET
 
 #define DP_MODE 0
 #define HUM_MODE 1
 
-class HumidityPanel: virtual public PanelBase {
+class HumidityPanel: public PanelBase {
   public:
     HumidityPanel(Adafruit_RA8875 *tft, uint16_t x, uint16_t y, int8_t current, bool indoor);
     void draw(void);
+    void reportDamage(void);
     void setHumidity(uint8_t humidity);
     void setDewPoint(uint8_t _dewPoint);
-    bool isClicked(uint16_t x, uint16_t y) override;
+    bool isClicked(uint16_t x, uint16_t y);
 
   private:
     Adafruit_RA8875 *tft;
@@ -0,0 +1,448 @@
+/**
+ *  @filename   :   Layout.h
+ *  @brief      :   ESP32 Ecowitt Weather Station Console, screen layout and static panel chrome
+ *
+ *  @author     :   Kevin Kessler
+ *
+ * Copyright (C) 2024 Kevin Kessler
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef INCLUDE_LAYOUT_H_
+#define INCLUDE_LAYOUT_H_
+
+#include <stdint.h>
+
+/*
+ * Where the panels sit and the chrome that never changes: borders, rounded corners and
+ * fixed labels.  Shared with tools/assetgen.cpp, which can bake the chrome into the
+ * background (the "chrome" option in assets/assets.txt), so keep it free of Arduino
+ * headers.  Panels draw their chrome with drawChrome() only when chromeBaked() is false.
+ */
+
+/*
+ * Two layouts, picked at compile time: the 800x480 the console was drawn up for and, built
+ * with -DLAYOUT_480x272, the smaller RA8875 panels.  The CGROM fonts come in fixed sizes,
+ * so the small layout is specialized by hand rather than scaled: its own panel geometry,
+ * shorter titles, a 32 pixel value cell (src/glyphs-480x272.cpp) and Arial 24 for the
+ * extremes.  Every offset the panels draw at and every click region derives from the
+ * values below.  The asset pipeline reads assets/assets-480x272.txt for the small layout,
+ * a background of that size and the "scaled" icons shrunk by ICON_SCALE().
+ */
+#ifdef LAYOUT_480x272
+#define SCREEN_WIDTH 480
+#define SCREEN_HEIGHT 272
+#define LAYOUT_RA8875_SIZE RA8875_480x272
+
+#define VALUE_CELL_HEIGHT 32      // CGROM Arial 32 at textEnlarge(0)
+#define VALUE_FONT_ENLARGE 0
+#define ARIAL_FONT_TYPE 0x42      // FONT_ARIAL is 24x24, 2 pixel spacing
+#define ARIAL_FIRST_DIGIT 12
+#define ARIAL_DIGIT_WIDTH 15
+#define ARIAL_SIGN_WIDTH 10
+#define ICON_SCALE(v) ((v)*9/16)
+#define CGROM_TEXT_WIDTH(n) ((n)*10)  // Internal font with the 2 pixel spacing
+
+#define CHROME_RADIUS 10
+#define PANEL_TITLE_INSET 10      // Title restore, clear of the rounded corners
+#define PANEL_TITLE_Y 3
+#define PANEL_TITLE_HEIGTH 18
+
+#define TEMP_WIDTH 150
+#define TEMP_HEIGTH 118
+#define TEMP_XTREME_YOFFSET 61
+#define TEMP_TITLE_INDOOR "Indoor Temp"
+#define TEMP_TITLE_INDOOR_X ((TEMP_WIDTH-CGROM_TEXT_WIDTH(11))/2)
+#define TEMP_TITLE_OUTDOOR "Outdoor Temp"
+#define TEMP_TITLE_OUTDOOR_X ((TEMP_WIDTH-CGROM_TEXT_WIDTH(12))/2)
+#define TEMP_TITLE_FEELS "Feels Like"
+#define TEMP_TITLE_FEELS_X ((TEMP_WIDTH-CGROM_TEXT_WIDTH(10))/2)
+
+#define HUM_WIDTH 150
+#define HUM_HEIGTH 109
+#define HUM_XTREME_YOFFSET 59
+#define HUM_TITLE_INDOOR "Indoor RH"
+#define HUM_TITLE_INDOOR_X ((HUM_WIDTH-CGROM_TEXT_WIDTH(9))/2)
+#define HUM_TITLE_OUTDOOR "Out"
+#define HUM_TITLE_OUTDOOR_X ((HUM_WIDTH-CGROM_TEXT_WIDTH(13))/2)
+#define HUM_TITLE_MODE_X (HUM_TITLE_OUTDOOR_X+CGROM_TEXT_WIDTH(4))
+#define HUM_TITLE_MODE_WIDTH CGROM_TEXT_WIDTH(9)
+
+#define RAIN_WIDTH 173
+#define RAIN_HEIGTH 70
+
+#define BARO_WIDTH 173
+#define BARO_HEIGTH 100
+#define BARO_XTREME_YOFFSET 57
+
+#define WIND_WIDTH 173
+#define WIND_HEIGTH 58
+
+// Value boxes, relative to the panel origin
+#define TEMP_VALUE_X 12
+#define TEMP_VALUE_Y 24
+#define TEMP_VALUE_WIDTH (TEMP_WIDTH-24)
+#define TEMP_VALUE_HEIGTH 36
+#define HUM_VALUE_X 20
+#define HUM_VALUE_Y 22
+#define HUM_VALUE_WIDTH (HUM_WIDTH-40)
+#define HUM_VALUE_HEIGTH 36
+#define RAIN_VALUE_X 6
+#define RAIN_VALUE_Y 22
+#define RAIN_VALUE_WIDTH (RAIN_WIDTH-50)
+#define RAIN_VALUE_HEIGTH (RAIN_HEIGTH-22)
+#define BARO_VALUE_X 6
+#define BARO_VALUE_Y 22
+#define BARO_VALUE_WIDTH 161
+#define BARO_VALUE_HEIGTH 35
+#define WIND_VALUE_X 12
+#define WIND_VALUE_Y 22
+#define WIND_VALUE_WIDTH (WIND_WIDTH-24)
+#define WIND_VALUE_HEIGTH (WIND_HEIGTH-24)
+
+// Top left of the value text cell, before the per value nudges (VALUE_SCALE() of the
+// 800x480 numbers)
+#define TEMP_TEXT_X 44
+#define TEMP_TEXT_Y 26
+#define HUM_TEXT_X 44
+#define HUM_DEW_TEXT_X 57
+#define HUM_TEXT_Y 24
+#define RAIN_TEXT_X 14
+#define RAIN_TEXT_Y 22
+#define BARO_TEXT_X 7             // Four digit hPa
+#define BARO_TEXT_SHORT_X 22      // Three digit hPa
+#define BARO_TEXT_HG_X 17
+#define BARO_TEXT_Y 23
+#define WIND_TEXT_X 17
+#define WIND_TEXT_Y 23
+
+// Icons and the other text inside the value boxes
+#define RAIN_ICON_X 131
+#define RAIN_ICON_Y 24
+#define RAIN_PERIOD_Y 54          // Small Arial period label, restored with the value box
+#define RAIN_PERIOD_HEIGTH 16
+#define BARO_ARROW_X 117
+#define BARO_ARROW_Y 25
+#define WIND_DIR_X 100            // Arial direction, three letters
+#define WIND_DIR_Y 26
+#define WIND_DIR_WIDTH (WIND_WIDTH-112)
+#define WIND_DIR_HEIGTH 24
+#define WIND_DIR_STEP 12          // Moved right per letter short of three
+
+// Low/High strip at x 1, y *_XTREME_YOFFSET, panel width - 1 wide
+#define XTREME_HEIGTH 40
+#define XTREME_LOW_X 12           // "Low" and "High" labels, the values centre under them
+#define XTREME_HIGH_INSET 50
+#define BARO_XTREME_LOW_X 20
+#define BARO_XTREME_HIGH_INSET 50
+#define BARO_XTREME_VALUE_X 4     // Barometer values are left aligned under the labels
+#define BARO_XTREME_VALUE_INSET 84
+
+// Temperature history below the extremes, on a solid box the panel draws itself
+#define SPARK_WIDTH 120
+#define SPARK_HEIGTH 12
+
+#define TEMP_OUTDOOR_Y 21
+#define HUM_OUTDOOR_Y 140
+#define RAIN_X 153
+#define RAIN_Y 21
+#define BARO_Y 91
+#define WIND_Y 191
+#else
+#define SCREEN_WIDTH 800
+#define SCREEN_HEIGHT 480
+#define LAYOUT_RA8875_SIZE RA8875_800x480
+
+#define VALUE_CELL_HEIGHT 64      // CGROM Arial 32 at textEnlarge(1)
+#define VALUE_FONT_ENLARGE 1
+#define ARIAL_FONT_TYPE 0x82      // FONT_ARIAL is 32x32, 2 pixel spacing
+#define ARIAL_FIRST_DIGIT 16
+#define ARIAL_DIGIT_WIDTH 20
+#define ARIAL_SIGN_WIDTH 13
+#define ICON_SCALE(v) (v)
+
+#define CHROME_RADIUS 25
+#define PANEL_TITLE_INSET 14      // Title restore, clear of the rounded corners
+#define PANEL_TITLE_Y 3
+#define PANEL_TITLE_HEIGTH 20
+
+#define TEMP_WIDTH 250
+#define TEMP_HEIGTH 230
+#define TEMP_XTREME_YOFFSET 155
+#define TEMP_TITLE_INDOOR "Indoor Temperature"
+#define TEMP_TITLE_INDOOR_X ((TEMP_WIDTH-172)/2)
+#define TEMP_TITLE_OUTDOOR "Outdoor Temperature"
+#define TEMP_TITLE_OUTDOOR_X ((TEMP_WIDTH-167)/2)
+#define TEMP_TITLE_FEELS "Feels-Like Temperature"
+#define TEMP_TITLE_FEELS_X ((TEMP_WIDTH-212)/2)
+
+#define HUM_WIDTH 250
+#define HUM_HEIGTH 190
+#define HUM_XTREME_YOFFSET 115
+#define HUM_TITLE_INDOOR "Indoor Humidity"
+#define HUM_TITLE_INDOOR_X ((HUM_WIDTH-154)/2)
+#define HUM_TITLE_OUTDOOR "Outdoor"
+#define HUM_TITLE_OUTDOOR_X ((HUM_WIDTH-160)/2)
+#define HUM_TITLE_MODE_X (HUM_TITLE_OUTDOOR_X + 8*8)
+#define HUM_TITLE_MODE_WIDTH 72
+
+#define RAIN_WIDTH 289
+#define RAIN_HEIGTH 130
+
+#define BARO_WIDTH 289
+#define BARO_HEIGTH 170
+#define BARO_XTREME_YOFFSET 115
+
+#define WIND_WIDTH 289
+#define WIND_HEIGTH 120
+
+// Value boxes, relative to the panel origin
+#define TEMP_VALUE_X 20
+#define TEMP_VALUE_Y 40
+#define TEMP_VALUE_WIDTH (TEMP_WIDTH-50)
+#define TEMP_VALUE_HEIGTH 90
+#define HUM_VALUE_X 40
+#define HUM_VALUE_Y 30
+#define HUM_VALUE_WIDTH (HUM_WIDTH-75)
+#define HUM_VALUE_HEIGTH 75
+#define RAIN_VALUE_X 10
+#define RAIN_VALUE_Y 30
+#define RAIN_VALUE_WIDTH (RAIN_WIDTH-90)
+#define RAIN_VALUE_HEIGTH (RAIN_HEIGTH-32)
+#define BARO_VALUE_X 15
+#define BARO_VALUE_Y 30
+#define BARO_VALUE_WIDTH 270
+#define BARO_VALUE_HEIGTH 85
+#define WIND_VALUE_X 25
+#define WIND_VALUE_Y 30
+#define WIND_VALUE_WIDTH (WIND_WIDTH-30)
+#define WIND_VALUE_HEIGTH (WIND_HEIGTH-42)
+
+// Top left of the value text cell, before the per value nudges
+#define TEMP_TEXT_X 60
+#define TEMP_TEXT_Y 60
+#define HUM_TEXT_X 60
+#define HUM_DEW_TEXT_X 90
+#define HUM_TEXT_Y 30
+#define RAIN_TEXT_X 30
+#define RAIN_TEXT_Y 30
+#define BARO_TEXT_X 15            // Four digit hPa
+#define BARO_TEXT_SHORT_X 45      // Three digit hPa
+#define BARO_TEXT_HG_X 35
+#define BARO_TEXT_Y 30
+#define WIND_TEXT_X 35
+#define WIND_TEXT_Y 30
+
+// Icons and the other text inside the value boxes
+#define RAIN_ICON_X 210
+#define RAIN_ICON_Y 45
+#define RAIN_PERIOD_Y 100         // Small Arial period label, restored with the value box
+#define RAIN_PERIOD_HEIGTH 28
+#define BARO_ARROW_X 235
+#define BARO_ARROW_Y 42
+#define WIND_DIR_X 160            // Arial direction, three letters
+#define WIND_DIR_Y 50
+#define WIND_DIR_WIDTH (WIND_WIDTH-165)
+#define WIND_DIR_HEIGTH 32
+#define WIND_DIR_STEP 16          // Moved right per letter short of three
+
+// Low/High strip at x 1, y *_XTREME_YOFFSET, panel width - 1 wide
+#define XTREME_HEIGTH 49
+#define XTREME_LOW_X 25           // "Low" and "High" labels, the values centre under them
+#define XTREME_HIGH_INSET (27+32)
+#define BARO_XTREME_LOW_X 34
+#define BARO_XTREME_HIGH_INSET (32+32)
+#define BARO_XTREME_VALUE_X 5     // Barometer values are left aligned under the labels
+#define BARO_XTREME_VALUE_INSET 115
+
+// Temperature history below the extremes, on a solid box the panel draws itself
+#define SPARK_WIDTH 200
+#define SPARK_HEIGTH 20
+
+#define TEMP_OUTDOOR_Y 30
+#define HUM_OUTDOOR_Y 261
+#define RAIN_X 255
+#define RAIN_Y 30
+#define BARO_Y 160
+#define WIND_Y 330
+#endif
+
+// Nudges of the value text, the 800x480 numbers for a 64 pixel cell
+#define VALUE_SCALE(v) ((v)*VALUE_CELL_HEIGHT/64)
+
+#define XTREME_VALUE_Y 15         // Values and period labels below the Low/High labels
+#define XTREME_LOW_CENTER (XTREME_LOW_X+(3*8)/2)
+#define XTREME_HIGH_CENTER(w) ((w)-XTREME_HIGH_INSET+(4*8)/2)
+#define BARO_PERIOD_X (BARO_WIDTH/2-5)
+
+#define TEMP_SPARK_X ((TEMP_WIDTH-SPARK_WIDTH)/2)
+#define TEMP_SPARK_Y (TEMP_HEIGTH-SPARK_HEIGTH-4)
+
+#define ERROR_HEIGTH 20
+#define ERROR_X 0
+#define ERROR_Y (SCREEN_HEIGHT-ERROR_HEIGTH-1)
+#define ERROR_WIDTH (SCREEN_WIDTH-1)
+
+#define TEMP_OUTDOOR_X 0
+#define TEMP_INDOOR_X (SCREEN_WIDTH-TEMP_WIDTH-1)
+#define TEMP_INDOOR_Y TEMP_OUTDOOR_Y
+#define HUM_OUTDOOR_X 0
+#define HUM_INDOOR_X (SCREEN_WIDTH-HUM_WIDTH-1)
+#define HUM_INDOOR_Y HUM_OUTDOOR_Y
+#define BARO_X RAIN_X
+#define WIND_X RAIN_X
+
+// Period labels in enum Extremes order, with half their small Arial width to centre them
+struct PeriodLabel {
+  const char *text;
+  int16_t half;
+};
+
+#ifdef LAYOUT_480x272
+static constexpr PeriodLabel xtremeLabels[] = {{"Day", 14}, {"Week", 19}, {"Month", 24}, {"Year", 19}};
+static constexpr PeriodLabel rainLabels[] = {{"24 Hour", 7*8/2}, {"7 Days", 6*8/2}, {"Month", 5*8/2}, {"Year", 4*8/2}};
+#else
+static constexpr PeriodLabel xtremeLabels[] = {{"Daily", 24}, {"Weekly", 29}, {"Monthly", 34}, {"Yearly", 29}};
+static constexpr PeriodLabel rainLabels[] = {{"24 Hour", 7*8/2}, {"7 Days", 6*8/2}, {"Month to Date", 13*8/2}, {"Year to Date", 12*8/2}};
+#endif
+
+#define CHROME_LINE 0           // x,y to a,b
+#define CHROME_CURVE 1          // Quarter circle centred on x,y, radius a, RA8875 curve part b
+#define CHROME_RECT 2           // a wide, b high
+#define CHROME_TEXT 3           // Internal 8x16 CGROM font, top left at x,y
+
+#define CHROME_BORDER 0         // Drawn with the border
+#define CHROME_EXTREMES 1       // Drawn after the extremes area is restored
+
+#define CHROME_ALWAYS 0
+#define CHROME_INDOOR 1
+#define CHROME_OUTDOOR 2
+
+#define CHROME_YELLOW 0xffe0
+#define CHROME_WHITE 0xffff
+
+// Positions are relative to the panel origin
+struct ChromeOp {
+  uint8_t type;
+  uint8_t group;
+  uint8_t when;
+  int16_t x;
+  int16_t y;
+  int16_t a;
+  int16_t b;
+  uint16_t color;
+  const char *text;
+};
+
+#define CHROME_COUNT(ops) (sizeof(ops)/sizeof((ops)[0]))
+
+static constexpr ChromeOp tempChrome[] = {
+  {CHROME_LINE, CHROME_BORDER, CHROME_ALWAYS, CHROME_RADIUS, 0, TEMP_WIDTH-CHROME_RADIUS, 0, CHROME_YELLOW, 0},
+  {CHROME_LINE, CHROME_BORDER, CHROME_ALWAYS, 0, CHROME_RADIUS, 0, TEMP_HEIGTH, CHROME_YELLOW, 0},
+  {CHROME_LINE, CHROME_BORDER, CHROME_ALWAYS, TEMP_WIDTH, CHROME_RADIUS, TEMP_WIDTH, TEMP_HEIGTH, CHROME_YELLOW, 0},
+  {CHROME_LINE, CHROME_BORDER, CHROME_ALWAYS, 0, TEMP_HEIGTH, TEMP_WIDTH, TEMP_HEIGTH, CHROME_YELLOW, 0},
+  {CHROME_CURVE, CHROME_BORDER, CHROME_ALWAYS, CHROME_RADIUS, CHROME_RADIUS, CHROME_RADIUS, 1, CHROME_YELLOW, 0},
+  {CHROME_CURVE, CHROME_BORDER, CHROME_ALWAYS, TEMP_WIDTH-CHROME_RADIUS, CHROME_RADIUS, CHROME_RADIUS, 2, CHROME_YELLOW, 0},
+  {CHROME_TEXT, CHROME_BORDER, CHROME_INDOOR, TEMP_TITLE_INDOOR_X, PANEL_TITLE_Y, 0, 0, CHROME_WHITE, TEMP_TITLE_INDOOR},
+  {CHROME_TEXT, CHROME_EXTREMES, CHROME_ALWAYS, XTREME_LOW_X, TEMP_XTREME_YOFFSET, 0, 0, CHROME_WHITE, "Low"},
+  {CHROME_TEXT, CHROME_EXTREMES, CHROME_ALWAYS, TEMP_WIDTH-XTREME_HIGH_INSET, TEMP_XTREME_YOFFSET, 0, 0, CHROME_WHITE, "High"},
+};
+
+// Outdoor titles are HUM_TITLE_OUTDOOR and then the mode, which the panel draws at HUM_TITLE_MODE_X
+static constexpr ChromeOp humChrome[] = {
+  {CHROME_LINE, CHROME_BORDER, CHROME_ALWAYS, 0, 0, 0, HUM_HEIGTH-CHROME_RADIUS, CHROME_YELLOW, 0},
+  {CHROME_LINE, CHROME_BORDER, CHROME_ALWAYS, HUM_WIDTH, 0, HUM_WIDTH, HUM_HEIGTH-CHROME_RADIUS, CHROME_YELLOW, 0},
+  {CHROME_LINE, CHROME_BORDER, CHROME_ALWAYS, CHROME_RADIUS, HUM_HEIGTH, HUM_WIDTH-CHROME_RADIUS, HUM_HEIGTH, CHROME_YELLOW, 0},
+  {CHROME_CURVE, CHROME_BORDER, CHROME_ALWAYS, CHROME_RADIUS, HUM_HEIGTH-CHROME_RADIUS, CHROME_RADIUS, 0, CHROME_YELLOW, 0},
+  {CHROME_CURVE, CHROME_BORDER, CHROME_ALWAYS, HUM_WIDTH-CHROME_RADIUS, HUM_HEIGTH-CHROME_RADIUS, CHROME_RADIUS, 3, CHROME_YELLOW, 0},
+  {CHROME_TEXT, CHROME_BORDER, CHROME_INDOOR, HUM_TITLE_INDOOR_X, PANEL_TITLE_Y, 0, 0, CHROME_WHITE, HUM_TITLE_INDOOR},
+  {CHROME_TEXT, CHROME_BORDER, CHROME_OUTDOOR, HUM_TITLE_OUTDOOR_X, PANEL_TITLE_Y, 0, 0, CHROME_WHITE, HUM_TITLE_OUTDOOR},
+  {CHROME_TEXT, CHROME_EXTREMES, CHROME_ALWAYS, XTREME_LOW_X, HUM_XTREME_YOFFSET, 0, 0, CHROME_WHITE, "Low"},
+  {CHROME_TEXT, CHROME_EXTREMES, CHROME_ALWAYS, HUM_WIDTH-XTREME_HIGH_INSET, HUM_XTREME_YOFFSET, 0, 0, CHROME_WHITE, "High"},
+};
+
+static constexpr ChromeOp rainChrome[] = {
+  {CHROME_LINE, CHROME_BORDER, CHROME_ALWAYS, CHROME_RADIUS, 0, RAIN_WIDTH-CHROME_RADIUS, 0, CHROME_YELLOW, 0},
+  {CHROME_LINE, CHROME_BORDER, CHROME_ALWAYS, 0, CHROME_RADIUS, 0, RAIN_HEIGTH, CHROME_YELLOW, 0},
+  {CHROME_LINE, CHROME_BORDER, CHROME_ALWAYS, RAIN_WIDTH, CHROME_RADIUS, RAIN_WIDTH, RAIN_HEIGTH, CHROME_YELLOW, 0},
+  {CHROME_LINE, CHROME_BORDER, CHROME_ALWAYS, 0, RAIN_HEIGTH, RAIN_WIDTH, RAIN_HEIGTH, CHROME_YELLOW, 0},
+  {CHROME_CURVE, CHROME_BORDER, CHROME_ALWAYS, CHROME_RADIUS, CHROME_RADIUS, CHROME_RADIUS, 1, CHROME_YELLOW, 0},
+  {CHROME_CURVE, CHROME_BORDER, CHROME_ALWAYS, RAIN_WIDTH-CHROME_RADIUS, CHROME_RADIUS, CHROME_RADIUS, 2, CHROME_YELLOW, 0},
+  {CHROME_TEXT, CHROME_BORDER, CHROME_ALWAYS, (RAIN_WIDTH-100)/2, PANEL_TITLE_Y, 0, 0, CHROME_WHITE, "Rain Gauge"},
+};
+
+static constexpr ChromeOp baroChrome[] = {
+  {CHROME_RECT, CHROME_BORDER, CHROME_ALWAYS, 0, 0, BARO_WIDTH+1, BARO_HEIGTH, CHROME_YELLOW, 0},
+  {CHROME_TEXT, CHROME_EXTREMES, CHROME_ALWAYS, BARO_XTREME_LOW_X, BARO_XTREME_YOFFSET, 0, 0, CHROME_WHITE, "Low"},
+  {CHROME_TEXT, CHROME_EXTREMES, CHROME_ALWAYS, BARO_WIDTH-BARO_XTREME_HIGH_INSET, BARO_XTREME_YOFFSET, 0, 0, CHROME_WHITE, "High"},
+};
+
+static constexpr ChromeOp windChrome[] = {
+  {CHROME_LINE, CHROME_BORDER, CHROME_ALWAYS, 0, 0, 0, WIND_HEIGTH-CHROME_RADIUS, CHROME_YELLOW, 0},
+  {CHROME_LINE, CHROME_BORDER, CHROME_ALWAYS, WIND_WIDTH, 0, WIND_WIDTH, WIND_HEIGTH-CHROME_RADIUS, CHROME_YELLOW, 0},
+  {CHROME_LINE, CHROME_BORDER, CHROME_ALWAYS, CHROME_RADIUS, WIND_HEIGTH, WIND_WIDTH-CHROME_RADIUS, WIND_HEIGTH, CHROME_YELLOW, 0},
+  {CHROME_CURVE, CHROME_BORDER, CHROME_ALWAYS, CHROME_RADIUS, WIND_HEIGTH-CHROME_RADIUS, CHROME_RADIUS, 0, CHROME_YELLOW, 0},
+  {CHROME_CURVE, CHROME_BORDER, CHROME_ALWAYS, WIND_WIDTH-CHROME_RADIUS, WIND_HEIGTH-CHROME_RADIUS, CHROME_RADIUS, 3, CHROME_YELLOW, 0},
+};
+
+// Every panel on screen, what the background bake draws
+struct LayoutPanel {
+  const ChromeOp *chrome;
+  uint8_t count;
+  int16_t x;
+  int16_t y;
+  bool indoor;
+};
+
+static constexpr LayoutPanel layoutPanels[] = {
+  {tempChrome, CHROME_COUNT(tempChrome), TEMP_OUTDOOR_X, TEMP_OUTDOOR_Y, false},
+  {tempChrome, CHROME_COUNT(tempChrome), TEMP_INDOOR_X, TEMP_INDOOR_Y, true},
+  {humChrome, CHROME_COUNT(humChrome), HUM_OUTDOOR_X, HUM_OUTDOOR_Y, false},
+  {humChrome, CHROME_COUNT(humChrome), HUM_INDOOR_X, HUM_INDOOR_Y, true},
+  {rainChrome, CHROME_COUNT(rainChrome), RAIN_X, RAIN_Y, false},
+  {baroChrome, CHROME_COUNT(baroChrome), BARO_X, BARO_Y, false},
+  {windChrome, CHROME_COUNT(windChrome), WIND_X, WIND_Y, false},
+};
+
+// Screen regions restored over and over, tools/assetgen.cpp crops a contiguous tile of
+// each out of the background (the "tiles" option) so the restore is a single burst
+struct LayoutRegion {
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+};
+
+#define TEMP_VALUE_REGION(px, py) {(px)+TEMP_VALUE_X, (py)+TEMP_VALUE_Y, TEMP_VALUE_WIDTH, TEMP_VALUE_HEIGTH}
+#define HUM_VALUE_REGION(px, py) {(px)+HUM_VALUE_X, (py)+HUM_VALUE_Y, HUM_VALUE_WIDTH, HUM_VALUE_HEIGTH}
+#define XTREME_REGION(px, py, w, yoff) {(px)+1, (py)+(yoff), (w)-1, XTREME_HEIGTH}
+
+static constexpr LayoutRegion layoutTiles[] = {
+  TEMP_VALUE_REGION(TEMP_OUTDOOR_X, TEMP_OUTDOOR_Y),
+  TEMP_VALUE_REGION(TEMP_INDOOR_X, TEMP_INDOOR_Y),
+  HUM_VALUE_REGION(HUM_OUTDOOR_X, HUM_OUTDOOR_Y),
+  HUM_VALUE_REGION(HUM_INDOOR_X, HUM_INDOOR_Y),
+  {RAIN_X+RAIN_VALUE_X, RAIN_Y+RAIN_VALUE_Y, RAIN_VALUE_WIDTH, RAIN_VALUE_HEIGTH},
+  {BARO_X+BARO_VALUE_X, BARO_Y+BARO_VALUE_Y, BARO_VALUE_WIDTH, BARO_VALUE_HEIGTH},
+  {WIND_X+WIND_VALUE_X, WIND_Y+WIND_VALUE_Y, WIND_VALUE_WIDTH, WIND_VALUE_HEIGTH},
+  XTREME_REGION(TEMP_OUTDOOR_X, TEMP_OUTDOOR_Y, TEMP_WIDTH, TEMP_XTREME_YOFFSET),
+  XTREME_REGION(TEMP_INDOOR_X, TEMP_INDOOR_Y, TEMP_WIDTH, TEMP_XTREME_YOFFSET),
+  XTREME_REGION(HUM_OUTDOOR_X, HUM_OUTDOOR_Y, HUM_WIDTH, HUM_XTREME_YOFFSET),
+  XTREME_REGION(HUM_INDOOR_X, HUM_INDOOR_Y, HUM_WIDTH, HUM_XTREME_YOFFSET),
+  XTREME_REGION(BARO_X, BARO_Y, BARO_WIDTH, BARO_XTREME_YOFFSET),
+  {ERROR_X, ERROR_Y, ERROR_WIDTH, ERROR_HEIGTH},
+};
+
+#endif /* INCLUDE_LAYOUT_H_ */
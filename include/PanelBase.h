@@ -27,10 +27,11 @@
 
 enum Extremes {DAILY, WEEKLY, MONTHLY, YEARLY};
 
+// Panels provide draw() and isClicked(x, y), PanelSet (PanelSet.h) calls them on the
+// concrete type, nothing here is virtual
 class PanelBase {
   public:
-   virtual bool isClicked(uint16_t x, uint16_t y) = 0;
-   virtual void draw(void) = 0;
+   void reportDamage(void) {}     // Queue background regions the next draw() will restore
 };
 
 #endif /* INCLUDE_PANELBASE_H_ */
\ No newline at end of file
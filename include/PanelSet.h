@@ -0,0 +1,96 @@
+/**
+ *  @filename   :   PanelSet.h
+ *  @brief      :   ESP32 Ecowitt Weather Station Console,  Static Panel Set
+ *
+ *  @author     :   Kevin Kessler
+ *
+ * Copyright (C) 2024 Kevin Kessler
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef INCLUDE_PANELSET_H_
+#define INCLUDE_PANELSET_H_
+
+#include <Arduino.h>
+#include <tuple>
+#include <type_traits>
+#include "PanelBase.h"
+
+/*
+ * The panels on screen, by reference to statically allocated objects, in draw order.
+ * Every loop over them is expanded at compile time into direct calls on the concrete
+ * panel types, so a frame or a touch needs no heap, no list walk and no vtable.
+ */
+template<typename... Panels>
+class PanelSet {
+  public:
+    static constexpr uint8_t count = sizeof...(Panels);
+
+    PanelSet(Panels &... p) : panels(p...) {}
+
+    void reportDamage(uint8_t n) { visit<0>(n, ReportDamage()); }
+    void draw(uint8_t n) { visit<0>(n, Draw()); }
+    bool isClicked(uint16_t x, uint16_t y) { return clicked<0>(x, y); }    // Stops at the first taker
+    int8_t indexOf(const PanelBase *p) { return find<0>(p); }
+
+  private:
+    std::tuple<Panels &...> panels;
+
+    struct ReportDamage {
+      template<typename P> void operator()(P &p) const { p.reportDamage(); }
+    };
+
+    struct Draw {
+      template<typename P> void operator()(P &p) const { p.draw(); }
+    };
+
+    template<uint8_t I, typename Op>
+    typename std::enable_if<(I < sizeof...(Panels))>::type visit(uint8_t n, Op op) {
+      if(n == I)
+        op(std::get<I>(panels));
+      else
+        visit<I+1>(n, op);
+    }
+
+    template<uint8_t I, typename Op>
+    typename std::enable_if<(I == sizeof...(Panels))>::type visit(uint8_t, Op) {}
+
+    template<uint8_t I>
+    typename std::enable_if<(I < sizeof...(Panels)), bool>::type clicked(uint16_t x, uint16_t y) {
+      return std::get<I>(panels).isClicked(x, y) || clicked<I+1>(x, y);
+    }
+
+    template<uint8_t I>
+    typename std::enable_if<(I == sizeof...(Panels)), bool>::type clicked(uint16_t, uint16_t) {
+      return false;
+    }
+
+    template<uint8_t I>
+    typename std::enable_if<(I < sizeof...(Panels)), int8_t>::type find(const PanelBase *p) {
+      return (static_cast<const PanelBase *>(&std::get<I>(panels)) == p) ? I : find<I+1>(p);
+    }
+
+    template<uint8_t I>
+    typename std::enable_if<(I == sizeof...(Panels)), int8_t>::type find(const PanelBase *) {
+      return -1;
+    }
+};
+
+template<typename... Panels>
+PanelSet<Panels...> makePanelSet(Panels &... p) {
+  return PanelSet<Panels...>(p...);
+}
+
+#endif /* INCLUDE_PANELSET_H_ */
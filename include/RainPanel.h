@@ -26,24 +26,24 @@
 #include <Arduino.h>
 #include "Adafruit_RA8875.h"
 #include "PanelBase.h"
+#include "Layout.h"
 
-#define RAIN_WIDTH 289
-#define RAIN_HEIGTH 130
 #define RAIN_CLICK_MIN_X 1
-#define RAIN_CLICK_MIN_Y (40)
+#define RAIN_CLICK_MIN_Y (RAIN_VALUE_Y+10)
 #define RAIN_CLICK_MAX_X (RAIN_WIDTH-1)
 #define RAIN_CLICK_MAX_Y (RAIN_HEIGTH - 1) 
 
 
-class RainPanel: virtual public PanelBase {
+class RainPanel: public PanelBase {
   public:
     RainPanel(Adafruit_RA8875 *tft, uint16_t x, uint16_t y);
     void draw(void);
+    void reportDamage(void);
     void setDailyRain(float rain);
     void setWeeklyRain(float rain);
     void setMonthlyRain(float rain);
     void setYearlyRain(float rain);
-    bool isClicked(uint16_t x, uint16_t y) override;
+    bool isClicked(uint16_t x, uint16_t y);
 
   private:
     Adafruit_RA8875 *tft;
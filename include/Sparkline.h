@@ -0,0 +1,68 @@
+/**
+ *  @filename   :   Sparkline.h
+ *  @brief      :   ESP32 Ecowitt Weather Station Console, scrolling history sparkline
+ *
+ *  @author     :   Kevin Kessler
+ *
+ * Copyright (C) 2024 Kevin Kessler
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef INCLUDE_SPARKLINE_H_
+#define INCLUDE_SPARKLINE_H_
+
+#include <Arduino.h>
+#include "Adafruit_RA8875.h"
+#include "Layout.h"
+
+#define SPARK_HISTORY_MS (3UL*60*60*1000)
+#define SPARK_COLUMN_MS (SPARK_HISTORY_MS/SPARK_WIDTH)    // SPARK_WIDTH columns cover three hours
+#define SPARK_MIN_SPAN 2          // Smallest vertical range, whole units
+#define SPARK_COLOR RA8875_CYAN
+#define SPARK_BACKGROUND RA8875_BLACK
+
+/*
+ * Trend of the recent values a panel receives, kept in a ring in RAM with one sample per
+ * column.  The plot sits on a solid box so it can scroll: while the scale holds, a new
+ * column is a BTE move of the plot one pixel left and a single line in the freed column.
+ * The scale is whole units around the values on screen, when it changes the plot is
+ * drawn again.
+ */
+class Sparkline {
+  public:
+    Sparkline(Adafruit_RA8875 *tft, uint16_t x, uint16_t y);
+    bool sample(float value);   // True once a new column is due
+    void draw(void);
+
+  private:
+    Adafruit_RA8875 *tft;
+    uint16_t x;
+    uint16_t y;
+    float ring[SPARK_WIDTH];
+    uint8_t head;               // Next slot to fill
+    uint8_t count;
+    uint8_t pending;            // Columns added since the last draw
+    uint32_t lastColumn;
+    int16_t lo;                 // Scale on screen
+    int16_t hi;
+    bool full;
+
+    float column(uint8_t n);
+    void scale(int16_t *newLo, int16_t *newHi);
+    uint16_t plotY(float value);
+    void drawColumn(uint8_t n);
+};
+
+#endif /* INCLUDE_SPARKLINE_H_ */
@@ -26,27 +26,28 @@
 #include <Arduino.h>
 #include "Adafruit_RA8875.h"
 #include "PanelBase.h"
+#include "Layout.h"
+#include "DisplayList.h"
+#include "Sparkline.h"
 
-#define TEMP_WIDTH 250
-#define TEMP_HEIGTH 230
-#define TEMP_XTREME_YOFFSET 155
 
 #define TEMP_CLICK_MIN_X 1
 #define TEMP_CLICK_MIN_Y (1)
 #define TEMP_CLICK_MAX_X (TEMP_WIDTH-1)
-#define TEMP_CLICK_MAX_Y (50) 
+#define TEMP_CLICK_MAX_Y (XTREME_HEIGTH+1)    // Below TEMP_XTREME_YOFFSET
 
 #define TEMP_MODE 0
 #define FEELS_MODE 1
 
 
-class TemperaturePanel: virtual public PanelBase {
+class TemperaturePanel: public PanelBase {
   public:
     TemperaturePanel(Adafruit_RA8875 *tft, uint16_t x, uint16_t y, float current, bool indoor);
     void draw(void);
+    void reportDamage(void);
     void setTemperature(float _temperature);
     void setFeelsLike(float _feels_like);
-    bool isClicked(uint16_t x, uint16_t y) override;
+    bool isClicked(uint16_t x, uint16_t y);
 
   private:
     Adafruit_RA8875 *tft;
@@ -66,6 +67,9 @@ class TemperaturePanel: virtual public PanelBase {
     bool tempDirty;
     bool extremeDirty;
     bool borderDirty;
+    DisplayList valueList;      // Value box, redrawn per changed character
+    Sparkline history;          // Recent temperatures, scrolled a column per sample
+    bool historyDirty;
     bool hasData;
 
     void drawThermometer(uint16_t x0, uint16_t y0);
@@ -26,9 +26,8 @@
 #include <Arduino.h>
 #include "Adafruit_RA8875.h"
 #include "PanelBase.h"
+#include "Layout.h"
 
-#define WIND_WIDTH 289
-#define WIND_HEIGTH 120
 #define WIND_CLICK_MIN_X 1
 #define WIND_CLICK_MIN_Y (1)
 #define WIND_CLICK_MAX_X (WIND_WIDTH-1)
@@ -38,15 +37,16 @@
 #define GUST_MODE 1
 #define MAXGUST_MODE 2
 
-class WindPanel: virtual public PanelBase {
+class WindPanel: public PanelBase {
   public:
     WindPanel(Adafruit_RA8875 *tft, uint16_t x, uint16_t y);
     void draw(void);
+    void reportDamage(void);
     void setWind(float wind);
     void setGust(float gust);
     void setMaxGust(float maxGust);
     void setDirection(char *direction);
-    bool isClicked(uint16_t x, uint16_t y) override;
+    bool isClicked(uint16_t x, uint16_t y);
 
   private:
     Adafruit_RA8875 *tft;
@@ -0,0 +1,77 @@
+/**
+ *  @filename   :   assetpack.h
+ *  @brief      :   ESP32 Ecowitt Weather Station Console, asset pack partition module
+ *
+ *  @author     :   Kevin Kessler
+ *
+ * Copyright (C) 2024 Kevin Kessler
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef INCLUDE_ASSETPACK_H_
+#define INCLUDE_ASSETPACK_H_
+
+#include <Arduino.h>
+#include "bitmaps.h"
+
+/*
+ * Asset pack kept in the "assets" data partition (big_partition.csv) and memory mapped
+ * at boot, so the background and icons are read straight out of flash like rodata but
+ * can be replaced without a firmware update.  Built by tools/assetgen.cpp --pack and
+ * uploaded to /assets.  Little endian:
+ *   AssetPackHeader
+ *   AssetPackEntry[count]
+ *   data, each asset on a 4 byte boundary at its entry's offset from the pack start
+ *     raw   RGB565 pixels, high byte first
+ *     rle   uint32_t rowOffsets[height], then the packets (rle.h)
+ *     mono  uint16_t colors[count] padded to 4 bytes, then count 1bpp planes (monoicon.h)
+ *     span  SpanRun[count], then the pixels (spanbitmap.h)
+ * An entry replaces the compiled in asset of the same name.
+ */
+#define ASSET_PACK_MAGIC 0x50414345    // "ECAP"
+#define ASSET_PACK_VERSION 1
+#define ASSET_PACK_NAME_LEN 16
+#define ASSET_PACK_MAX_ASSETS 16
+#define ASSET_PACK_MAX_PLANES 4
+#define ASSET_PACK_SUBTYPE 0x40        // Custom data subtype in the partition table
+
+struct AssetPackHeader {
+  uint32_t magic;
+  uint16_t version;
+  uint16_t count;
+  uint32_t size;          // Bytes used from the partition start, what gets mapped
+  uint32_t reserved;
+};
+
+struct AssetPackEntry {
+  char name[ASSET_PACK_NAME_LEN];
+  uint8_t format;         // ASSET_RAW etc.
+  uint8_t flags;          // ASSET_FLAG_CHROME
+  uint16_t width;
+  uint16_t height;
+  uint16_t count;         // Mono planes or span windows
+  uint32_t offset;
+  uint32_t length;
+};
+
+bool assetPackBegin(void);
+void assetPackEnd(void);
+const Asset *assetPackFind(const char *name);
+const Asset *assetPackResolve(const Asset *builtin);
+bool assetPackWriteBegin(void);
+bool assetPackWrite(const uint8_t *data, size_t len);
+bool assetPackWriteEnd(void);
+
+#endif /* INCLUDE_ASSETPACK_H_ */
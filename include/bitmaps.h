@@ -0,0 +1,64 @@
+// Generated by tools/assetgen.cpp from assets/assets.txt, do not edit
+#ifndef INCLUDE_BITMAPS_H_
+#define INCLUDE_BITMAPS_H_
+
+#include <Arduino.h>
+#include "rle.h"
+#include "monoicon.h"
+#include "spanbitmap.h"
+
+#define ASSET_RAW 0
+#define ASSET_RLE 1
+#define ASSET_MONO 2
+#define ASSET_SPAN 3
+
+#define ASSET_FLAG_CHROME 0x01  // Panel borders and fixed labels (Layout.h) are in the image
+
+struct Asset {
+  const char *name;       // Replaced by the asset pack entry of the same name
+  uint8_t format;
+  uint8_t flags;
+  uint16_t width;
+  uint16_t height;
+  const void *data;
+};
+
+struct AssetTile {      // Contiguous crop of a screen sized asset, RGB565 high byte first
+  uint16_t x;
+  uint16_t y;
+  uint16_t w;
+  uint16_t h;
+  const uint8_t *data;
+};
+
+#define ASSET_UP_ARROW_WIDTH 43
+#define ASSET_UP_ARROW_HEIGHT 50
+#define ASSET_UP_ARROW_FORMAT ASSET_MONO
+extern const MonoIcon up_arrow_mono;
+extern const Asset up_arrow_asset;
+
+#define ASSET_DOWN_ARROW_WIDTH 43
+#define ASSET_DOWN_ARROW_HEIGHT 50
+#define ASSET_DOWN_ARROW_FORMAT ASSET_MONO
+extern const MonoIcon down_arrow_mono;
+extern const Asset down_arrow_asset;
+
+#define ASSET_STEADY_WIDTH 43
+#define ASSET_STEADY_HEIGHT 50
+#define ASSET_STEADY_FORMAT ASSET_MONO
+extern const MonoIcon steady_mono;
+extern const Asset steady_asset;
+
+#define ASSET_BATTERY_WIDTH 28
+#define ASSET_BATTERY_HEIGHT 20
+#define ASSET_BATTERY_FORMAT ASSET_MONO
+extern const MonoIcon battery_mono;
+extern const Asset battery_asset;
+
+#define ASSET_RAIN_WIDTH 50
+#define ASSET_RAIN_HEIGHT 50
+#define ASSET_RAIN_FORMAT ASSET_SPAN
+extern const SpanBitmap rain_span;
+extern const Asset rain_asset;
+
+#endif /* INCLUDE_BITMAPS_H_ */
@@ -24,32 +24,92 @@
 #define INCLUDE_DISPLAY_H_
 
 #include "PanelBase.h"
+#include "rle.h"
+#include "monoicon.h"
+#include "spanbitmap.h"
+#include "bitmaps.h"
+#include "Layout.h"
 
 #define CS 5
 #define RST 21
 #define WAIT_PIN 20
 
+#define FONT_INTERNAL 0
+#define FONT_ARIAL 1          // Extremes, ARIAL_FONT_TYPE of the layout
+#define FONT_SMALL_ARIAL 2
+#define FONT_VALUE 3          // Arial 32, VALUE_FONT_ENLARGE fills the value cell
+
+// Large panel values are either CGROM Arial text over a background restore, the box
+// composited from the background and the glyph atlas (glyphs.h) and written in one upload,
+// or seven segment digits (segment.h) where only the segments that changed are touched.
+// Select with -DVALUE_RENDERER=VALUE_RENDER_CGROM or VALUE_RENDER_SEGMENT
+#define VALUE_RENDER_CGROM 0
+#define VALUE_RENDER_ATLAS 1
+#define VALUE_RENDER_SEGMENT 2
+#ifndef VALUE_RENDERER
+#define VALUE_RENDERER VALUE_RENDER_ATLAS
+#endif
+
+// Build with -DBACKGROUND_RLE to restore the background from the row indexed RLE
+// image background_rle (tools/assetgen.cpp) instead of the raw background_bmp
+// Build with -DASSET_PACK_BACKGROUND to leave the background out of the firmware image, it
+// then only comes from the asset pack (assetpack.h)
+// Build with -DDISPLAY_TWO_LAYER to run the RA8875 at 8bpp with the background quantized
+// into layer 2 at boot, panels then draw into layer 1 and restores become hardware fills
+// Build with -DDISPLAY_FRAME_STATS to print the damage, display list and register stats of
+// every frame on Serial, otherwise they are only read through the get*Stats() calls
+#ifndef ASSET_PACK_BACKGROUND
+#ifdef BACKGROUND_RLE
+extern const RleImage background_rle;
+#else
 extern const uint8_t background_bmp[];
+#endif
+#endif
 extern const uint8_t therm_bmp[];
 extern const uint8_t hg_bmp[];
-extern const uint8_t battery[];
-extern const uint8_t rain[];
-extern const uint8_t up_arrow[];
-extern const uint8_t down_arrow[];
-extern const uint8_t steady[];
-
-struct PanelList {
-  PanelBase *p;
-  PanelList *next;
+
+struct DamageStats {
+  uint32_t rawArea;         // Pixels reported by the panels
+  uint32_t mergedArea;      // Pixels actually restored after merging
+  uint16_t rawRects;
+  uint16_t mergedRects;
+  uint16_t skippedRestores; // redrawBackgroundSection() calls covered by a merged restore
+};
+
+typedef void (*DisplayCallback)(void);
+
+struct ComposeIcon {
+  uint16_t x;
+  uint16_t y;
+  const Asset *asset;     // Already resolved through the asset pack
 };
 
 void redrawBackgroundSection(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
-void printString(const char *s);
-void setArialFont(void);
-void setSmallArialFont(void);
+void selectBackground(void);
+bool chromeBaked(void);
+void drawChrome(uint16_t x, uint16_t y, const ChromeOp *ops, uint8_t count, uint8_t group, bool indoor);
+void addDamage(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+bool damageOverlaps(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+const DamageStats *getDamageStats(void);
+void addValueDamage(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+void redrawValueBoxSection(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+void drawLargeValue(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t textx, uint16_t texty, const char *s);
+void drawComposedValue(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t textx, uint16_t texty, const char *s,
+  const ComposeIcon *icons, uint8_t iconCount);
+void queueString(uint16_t x, uint16_t y, uint8_t font, uint8_t enlarge, uint16_t color, const char *s);
 void drawTransparentBitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t *bitmap);
+void drawMonoIcon(uint16_t x, uint16_t y, const MonoIcon *icon);
+void drawSpanBitmap(uint16_t x, uint16_t y, const SpanBitmap *bitmap);
+void drawAsset(uint16_t x, uint16_t y, const Asset *asset);
+void moveRect(uint16_t srcx, uint16_t srcy, uint16_t w, uint16_t h, uint16_t dstx, uint16_t dsty);
+void drawTransparentBitmapStreamed(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t *bitmap, DisplayCallback done);
+bool displayBusy(void);
+void waitDisplayIdle(void);
+void readScreenRow(uint16_t y, uint8_t *dst);
 void drawCenteredArial(uint16_t centerx, uint16_t centery, int8_t value);
 void setError(const char *errStr);
+void raiseError(const char *errStr, uint8_t severity);
 void tftCTPTouch(uint16_t x, uint16_t y);
+void schedulePanel(PanelBase *p, bool touched);
 
 #endif /* INCLUDE_DISPLAY_H_ */
\ No newline at end of file
@@ -25,6 +25,11 @@
 #define GMT_OFFSET_SECS -18000
 #define DAYLIGHT_OFFSET_SECS 3600
 
+// Error severities, the error bar shows the most severe active errors
+#define ERROR_INFO 0
+#define ERROR_WARNING 1
+#define ERROR_CRITICAL 2
+
 bool writeConf(void);
 void otaSetup(void);
 bool initWiFi(void);
@@ -35,5 +40,6 @@ void mqttLoop(void);
 bool setData(char *name, char *value);
 void drawAll(void);
 void setError(const char *errStr);
+void raiseError(const char *errStr, uint8_t severity);
 void clearError(void);
 #endif /*INCLUDE_ECOCONSOLE_H_*/
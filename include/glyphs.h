@@ -0,0 +1,57 @@
+/**
+ *  @filename   :   glyphs.h
+ *  @brief      :   ESP32 Ecowitt Weather Station Console, anti-aliased value glyph atlas
+ *
+ *  @author     :   Kevin Kessler
+ *
+ * Copyright (C) 2024 Kevin Kessler
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef INCLUDE_GLYPHS_H_
+#define INCLUDE_GLYPHS_H_
+
+#include <Arduino.h>
+#include "Layout.h"
+
+/*
+ * Large value glyphs with 4 bit coverage, two pixels per byte with the left pixel in the
+ * high nibble.  Every glyph is a full GLYPH_HEIGHT cell advance pixels wide, rows padded
+ * to a whole byte, so the cell lines up with the CGROM value font of the layout.
+ * Generated by tools/glyphgen.cpp into src/glyphs.cpp, and src/glyphs-480x272.cpp for
+ * the 32 pixel cell of -DLAYOUT_480x272
+ */
+#define GLYPH_HEIGHT VALUE_CELL_HEIGHT
+#define GLYPH_COUNT 15
+#define GLYPH_MAX_ALPHA 15
+
+struct GlyphInfo {
+  char c;
+  uint8_t advance;
+  uint16_t offset;      // Into glyph_alpha
+};
+
+extern const uint8_t glyph_alpha[];
+extern const GlyphInfo glyph_info[GLYPH_COUNT];
+
+static inline const GlyphInfo *glyphLookup(char c) {
+  for(uint8_t n=0;n<GLYPH_COUNT;n++) {
+    if(glyph_info[n].c == c)
+      return &glyph_info[n];
+  }
+  return NULL;
+}
+
+#endif /* INCLUDE_GLYPHS_H_ */
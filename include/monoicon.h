@@ -0,0 +1,46 @@
+/**
+ *  @filename   :   monoicon.h
+ *  @brief      :   ESP32 Ecowitt Weather Station Console, colour expansion icons
+ *
+ *  @author     :   Kevin Kessler
+ *
+ * Copyright (C) 2024 Kevin Kessler
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef INCLUDE_MONOICON_H_
+#define INCLUDE_MONOICON_H_
+
+#include <Arduino.h>
+
+/*
+ * Icon stored as 1bpp planes, one per colour, drawn with the RA8875 BTE colour expansion
+ * with transparency.  Set bits take the plane colour, clear bits leave the display alone.
+ * Rows are padded to whole bytes, most significant bit first.
+ * Generated from the PNGs in assets/ by tools/assetgen.cpp
+ */
+struct MonoPlane {
+  uint16_t color;         // RGB565
+  const uint8_t *bits;
+};
+
+struct MonoIcon {
+  uint16_t width;
+  uint16_t height;
+  uint8_t planes;
+  const MonoPlane *plane;
+};
+
+#endif /* INCLUDE_MONOICON_H_ */
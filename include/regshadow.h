@@ -0,0 +1,77 @@
+/**
+ *  @filename   :   regshadow.h
+ *  @brief      :   ESP32 Ecowitt Weather Station Console, RA8875 register shadow module
+ *
+ *  @author     :   Kevin Kessler
+ *
+ * Copyright (C) 2024 Kevin Kessler
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef INCLUDE_REGSHADOW_H_
+#define INCLUDE_REGSHADOW_H_
+
+#include <Arduino.h>
+#include "Adafruit_RA8875.h"
+
+/*
+ * Shadow copy of the RA8875 registers display.cpp owns.  Only registers that the
+ * Adafruit library never writes on its own may go through shadowWriteReg(), anything
+ * the library also touches (0x21 by textMode(), 0x63-0x65 by every colour setter and
+ * shape) has to use shadowForceWriteReg() so the write is never skipped.
+ */
+struct ShadowStats {
+  uint32_t issued;          // Register writes sent to the controller
+  uint32_t skipped;         // Writes dropped because the controller already held the value
+  uint32_t readsServed;     // Register reads answered from the shadow
+  uint32_t readsIssued;
+};
+
+/*
+ * Register writes collected into a batch go out back to back inside one SPI transaction.
+ * The RA8875 decides between command and data cycles on the first byte after chip select,
+ * so CS still toggles between cycles, but the bus lock, clock setup and the library's
+ * per-call overhead are paid once per batch instead of twice per register.
+ */
+#define REG_BATCH_MAX 20
+#define REG_SPI_CLOCK 20000000UL
+#define REG_BATCH_COMMAND 0x01   // Command cycle only, no data byte
+
+struct RegBatch {
+  uint8_t count;
+  uint8_t reg[REG_BATCH_MAX];
+  uint8_t val[REG_BATCH_MAX];
+  uint8_t flags[REG_BATCH_MAX];
+};
+
+void shadowInit(Adafruit_RA8875 *tft, uint8_t cs);
+bool shadowNeedsWrite(uint8_t reg, uint8_t val);
+void shadowRecord(uint8_t reg, uint8_t val);
+void shadowWriteReg(uint8_t reg, uint8_t val);
+void shadowForceWriteReg(uint8_t reg, uint8_t val);
+void shadowTriggerReg(uint8_t reg, uint8_t val, uint8_t selfClearing);
+uint8_t shadowReadReg(uint8_t reg);
+void shadowInvalidate(uint8_t reg);
+void shadowInvalidateAll(void);
+const ShadowStats *getShadowStats(void);
+
+void batchBegin(RegBatch *b);
+void batchWrite(RegBatch *b, uint8_t reg, uint8_t val);
+void batchForceWrite(RegBatch *b, uint8_t reg, uint8_t val);
+void batchTrigger(RegBatch *b, uint8_t reg, uint8_t val, uint8_t selfClearing);
+void batchCommand(RegBatch *b, uint8_t cmd);
+void batchFlush(RegBatch *b);
+
+#endif /* INCLUDE_REGSHADOW_H_ */
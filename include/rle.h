@@ -0,0 +1,57 @@
+/**
+ *  @filename   :   rle.h
+ *  @brief      :   ESP32 Ecowitt Weather Station Console, run length encoded image module
+ *
+ *  @author     :   Kevin Kessler
+ *
+ * Copyright (C) 2024 Kevin Kessler
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef INCLUDE_RLE_H_
+#define INCLUDE_RLE_H_
+
+#include <Arduino.h>
+
+/*
+ * Row indexed RLE of an RGB565 image, pixels stored high byte first like the raw bitmaps.
+ * Every row starts a new packet stream at data[rowOffsets[row]], so any rectangle can be
+ * decoded without touching the rows above it.  Packet header byte:
+ *   1nnnnnnn  run of n+1 copies of the next pixel (3 bytes)
+ *   0nnnnnnn  n+1 literal pixels follow (1+2*(n+1) bytes)
+ * Generated from the PNGs in assets/ by tools/assetgen.cpp
+ */
+#define RLE_RUN 0x80
+#define RLE_MAX_PACKET 128
+
+struct RleImage {
+  uint16_t width;
+  uint16_t height;
+  const uint32_t *rowOffsets;
+  const uint8_t *data;
+};
+
+struct RleCursor {
+  const uint8_t *p;
+  uint8_t remaining;       // Pixels left in the current packet
+  bool run;
+  uint8_t pixel[2];
+};
+
+void rleSeek(RleCursor *c, const RleImage *img, uint16_t x, uint16_t y);
+void rleRead(RleCursor *c, uint8_t *dst, uint16_t pixels);
+void rleStreamRect(const RleImage *img, uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+#endif /* INCLUDE_RLE_H_ */
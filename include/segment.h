@@ -0,0 +1,41 @@
+/**
+ *  @filename   :   segment.h
+ *  @brief      :   ESP32 Ecowitt Weather Station Console, seven segment value renderer
+ *
+ *  @author     :   Kevin Kessler
+ *
+ * Copyright (C) 2024 Kevin Kessler
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef INCLUDE_SEGMENT_H_
+#define INCLUDE_SEGMENT_H_
+
+#include <Arduino.h>
+#include "Adafruit_RA8875.h"
+
+/*
+ * Large values drawn as rounded segments with the RA8875 fill engine.  The string last
+ * drawn in each value box is kept, so an update erases only the segments that went out
+ * (a background restore of the segment's bounds) and fills only the ones that came on.
+ * Cells are laid out on the same VALUE_CELL_HEIGHT cell (Layout.h) as the CGROM value font.
+ */
+#define SEG_MAX_FIELDS 8
+#define SEG_MAX_TEXT 12
+
+void segmentDrawValue(Adafruit_RA8875 *tft, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t textx, uint16_t texty, const char *s);
+void segmentForget(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+
+#endif /* INCLUDE_SEGMENT_H_ */
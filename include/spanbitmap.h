@@ -0,0 +1,53 @@
+/**
+ *  @filename   :   spanbitmap.h
+ *  @brief      :   ESP32 Ecowitt Weather Station Console, span encoded transparent bitmaps
+ *
+ *  @author     :   Kevin Kessler
+ *
+ * Copyright (C) 2024 Kevin Kessler
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+#ifndef INCLUDE_SPANBITMAP_H_
+#define INCLUDE_SPANBITMAP_H_
+
+#include <Arduino.h>
+
+/*
+ * Transparent RGB565 bitmap kept as rectangles covering its opaque pixels, so only those
+ * go over SPI.  Each rectangle is one BTE window, its pixels follow the previous one's in
+ * pixels[], row by row, high byte first.  Gaps cheaper to send than a new window are left
+ * in as white, which the transparent write skips.  runCount of 0 means the bitmap was
+ * dense enough that one window for the whole of it wins, pixels[] then holds all of it.
+ * Generated from the PNGs in assets/ by tools/assetgen.cpp
+ */
+#define SPAN_WINDOW_COST 28     // SPI bytes to set up a window, registers the shadow can't skip
+
+struct SpanRun {
+  uint8_t x;
+  uint8_t y;
+  uint8_t w;
+  uint8_t h;
+};
+
+struct SpanBitmap {
+  uint16_t width;
+  uint16_t height;
+  uint16_t runCount;
+  const SpanRun *runs;
+  const uint8_t *pixels;
+};
+
+#endif /* INCLUDE_SPANBITMAP_H_ */
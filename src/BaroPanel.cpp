@@ -26,7 +26,7 @@
 #include "display.h"
 #include "InfluxDBQueries.h"
 
-BaroPanel::BaroPanel(Adafruit_RA8875 *_tft, uint16_t _x, uint16_t _y) {
+BaroPanel::BaroPanel(Adafruit_RA8875 *_tft, uint16_t _x, uint16_t _y) : valueList(_tft) {
   tft = _tft;
   x_org = _x;
   y_org = _y;
@@ -49,19 +49,15 @@ BaroPanel::BaroPanel(Adafruit_RA8875 *_tft, uint16_t _x, uint16_t _y) {
 void BaroPanel::draw() {
 
   if(borderDirty) {
-    tft->graphicsMode();
-    tft->drawRect(x_org,y_org,BARO_WIDTH+1,BARO_HEIGTH,RA8875_YELLOW);
+    waitDisplayIdle();
+    if(!chromeBaked())
+      drawChrome(x_org, y_org, baroChrome, CHROME_COUNT(baroChrome), CHROME_BORDER, false);
 
-    tft->textMode();
-    tft->textTransparent(RA8875_WHITE);
-    tft->textEnlarge(0);
-    tft->textSetCursor(x_org+(BARO_WIDTH - 130)/2, y_org+3);
-
-    redrawBackgroundSection(x_org + 14, y_org +3, BARO_WIDTH - 28, 20);
+    redrawBackgroundSection(x_org + PANEL_TITLE_INSET, y_org + PANEL_TITLE_Y, BARO_WIDTH - 2*PANEL_TITLE_INSET, PANEL_TITLE_HEIGTH);
     if(displayMode==HPA_MODE)
-      printString("Barometer hPa");
+      queueString(x_org+(BARO_WIDTH - 130)/2, y_org+PANEL_TITLE_Y, FONT_INTERNAL, 0, RA8875_WHITE, "Barometer hPa");
     else 
-      printString("Barameter inHg");
+      queueString(x_org+(BARO_WIDTH - 130)/2, y_org+PANEL_TITLE_Y, FONT_INTERNAL, 0, RA8875_WHITE, "Barameter inHg");
 
     borderDirty = false;
   }
@@ -77,41 +73,40 @@ void BaroPanel::draw() {
 
 
 
-    uint8_t y_offset=30;
-    redrawBackgroundSection(x_org+15,y_org+y_offset,270,85);
-
-    tft->textMode();
-    setArialFont();
-    tft->textEnlarge(1);
-
     char buffer[6];
+    uint16_t x_text;
 
     if(displayMode == HPA_MODE) {
       sprintf(buffer,"%5.1f", pressure);
       if(pressure < 1000.0)
-        tft->textSetCursor(x_org+45,y_org+y_offset);
+        x_text = x_org+BARO_TEXT_SHORT_X;
       else
-        tft->textSetCursor(x_org+15,y_org+y_offset);
+        x_text = x_org+BARO_TEXT_X;
     } else {
         float hgPress = pressure / HPA_HG_CONVERSION;
         sprintf(buffer,"%4.2f", hgPress);
-        tft->textSetCursor(x_org+35,y_org+y_offset);
+        x_text = x_org+BARO_TEXT_HG_X;
 
     }
-    printString(buffer);
-
+    const Asset *arrow;
     switch(baroDir) {
       case BARO_RISING:
-        drawTransparentBitmap(x_org+235,y_org+y_offset+12,43,50, up_arrow);
+        arrow = &up_arrow_asset;
         break;
       case BARO_FALLING:
-        drawTransparentBitmap(x_org+235,y_org+y_offset+12,43,50, down_arrow);
+        arrow = &down_arrow_asset;
         break;
-      case BARO_STEADY:
-        drawTransparentBitmap(x_org+235,y_org+y_offset+12,43,50, steady);
+      default:
+        arrow = &steady_asset;
         break;
     }
 
+    // The value clears the box, the arrow goes on top of it
+    valueList.begin();
+    valueList.text(x_org+BARO_VALUE_X, y_org+BARO_VALUE_Y, BARO_VALUE_WIDTH, BARO_VALUE_HEIGTH, x_text, y_org+BARO_TEXT_Y, buffer);
+    valueList.asset(x_org+BARO_ARROW_X, y_org+BARO_ARROW_Y, arrow);
+    valueList.end();
+
     baroDirty = false;
   }
 
@@ -121,6 +116,17 @@ void BaroPanel::draw() {
   }
 }
 
+void BaroPanel::reportDamage() {
+  if(borderDirty)
+    addDamage(x_org + PANEL_TITLE_INSET, y_org + PANEL_TITLE_Y, BARO_WIDTH - 2*PANEL_TITLE_INSET, PANEL_TITLE_HEIGTH);
+
+  if(baroDirty)
+    addValueDamage(x_org+BARO_VALUE_X, y_org+BARO_VALUE_Y, BARO_VALUE_WIDTH, BARO_VALUE_HEIGTH);
+
+  if(extremeDirty)
+    addDamage(x_org+ 1, y_org+BARO_XTREME_YOFFSET, BARO_WIDTH-1, XTREME_HEIGTH);
+}
+
 void BaroPanel::setPressure(float baro) {
   // Compare displayed numbers
   if((++averagePoll>9)||(average == 0.0)) {
@@ -158,50 +164,20 @@ void BaroPanel::setPressure(float baro) {
 }
 
 void BaroPanel::drawExtremes() {
-  redrawBackgroundSection(x_org+ 1, y_org+BARO_XTREME_YOFFSET, BARO_WIDTH-1, 49);
+  redrawBackgroundSection(x_org+ 1, y_org+BARO_XTREME_YOFFSET, BARO_WIDTH-1, XTREME_HEIGTH);
 
-  tft->textMode();
-  tft->textTransparent(RA8875_WHITE);
+  if(!chromeBaked())
+    drawChrome(x_org, y_org, baroChrome, CHROME_COUNT(baroChrome), CHROME_EXTREMES, false);
   
-  tft->textEnlarge(0);
-
-  tft->textSetCursor(x_org+34,y_org+BARO_XTREME_YOFFSET);
-  printString("Low");
-  tft->textSetCursor(x_org+BARO_WIDTH-32-32,y_org+BARO_XTREME_YOFFSET);
-  printString("High");
-  
-  setSmallArialFont();
-  tft->textEnlarge(0);
-  switch(highlow) {
-    case DAILY:
-      tft->textSetCursor(x_org+(BARO_WIDTH/2)-29,y_org+BARO_XTREME_YOFFSET);
-      printString("Daily");
-      break;
-    case WEEKLY:
-      tft->textSetCursor(x_org+(BARO_WIDTH/2)-34,y_org+BARO_XTREME_YOFFSET);
-      printString("Weekly");
-      break;
-    case MONTHLY:
-      tft->textSetCursor(x_org+(BARO_WIDTH/2)-39,y_org+BARO_XTREME_YOFFSET);
-      printString("Monthly");
-      break;
-    case YEARLY:
-      tft->textSetCursor(x_org+(BARO_WIDTH/2)-34,y_org+BARO_XTREME_YOFFSET);
-      printString("Yearly");
-      break;      
-    default:
-      break;
-  }
+  const PeriodLabel *label = &xtremeLabels[highlow];
+  queueString(x_org+BARO_PERIOD_X-label->half,y_org+BARO_XTREME_YOFFSET,FONT_SMALL_ARIAL,0,RA8875_WHITE,label->text);
 
   char buffer[6];
-  setArialFont();
   sprintf(buffer,"%5.1f",low);
-  tft->textSetCursor(x_org+5,y_org+BARO_XTREME_YOFFSET+15);
-  printString(buffer);
+  queueString(x_org+BARO_XTREME_VALUE_X,y_org+BARO_XTREME_YOFFSET+XTREME_VALUE_Y,FONT_ARIAL,0,RA8875_WHITE,buffer);
 
   sprintf(buffer,"%5.1f",high);
-  tft->textSetCursor(x_org+BARO_WIDTH-115,y_org+BARO_XTREME_YOFFSET+15);
-  printString(buffer);
+  queueString(x_org+BARO_WIDTH-BARO_XTREME_VALUE_INSET,y_org+BARO_XTREME_YOFFSET+XTREME_VALUE_Y,FONT_ARIAL,0,RA8875_WHITE,buffer);
 
 }
 
@@ -239,7 +215,7 @@ bool BaroPanel::isClicked(uint16_t x, uint16_t y) {
 
     extremeDirty = true;
 
-    draw();
+    schedulePanel(this, true);
     return true;
   }
 
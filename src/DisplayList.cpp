@@ -0,0 +1,394 @@
+/**
+ *  @filename   :   DisplayList.cpp
+ *  @brief      :   ESP32 Ecowitt Weather Station Console, retained display list
+ *
+ *  @author     :   Kevin Kessler
+ *
+ * Copyright (C) 2024 Kevin Kessler
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <Arduino.h>
+#include "Adafruit_RA8875.h"
+#include "display.h"
+#include "glyphs.h"
+#include "DisplayList.h"
+#include "assetpack.h"
+
+DisplayListStats DisplayList::stats;
+
+DisplayList::DisplayList(Adafruit_RA8875 *_tft) {
+  tft = _tft;
+  count[0] = 0;
+  count[1] = 0;
+  current = 0;
+  valid = false;
+  dirtyCount = 0;
+  allDirty = false;
+}
+
+void DisplayList::begin() {
+  count[current] = 0;
+}
+
+DisplayOp *DisplayList::add(uint8_t type, uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+  if(count[current] == DL_MAX_OPS) {
+    Serial.println("Display list full");
+    return NULL;
+  }
+
+  DisplayOp *op = &ops[current][count[current]++];
+  memset(op, 0, sizeof(DisplayOp));
+  op->type = type;
+  op->x = x;
+  op->y = y;
+  op->w = w;
+  op->h = h;
+  return op;
+}
+
+void DisplayList::text(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t textx, uint16_t texty, const char *s) {
+  DisplayOp *op = add(DL_OP_TEXT, x, y, w, h);
+  if(op == NULL)
+    return;
+
+  op->textx = textx;
+  op->texty = texty;
+  strncpy(op->text, s, DL_MAX_TEXT-1);
+}
+
+void DisplayList::bitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t *bitmap) {
+  DisplayOp *op = add(DL_OP_BITMAP, x, y, w, h);
+  if(op != NULL)
+    op->bitmap = bitmap;
+}
+
+void DisplayList::rect(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t color) {
+  DisplayOp *op = add(DL_OP_RECT, x, y, w, h);
+  if(op != NULL)
+    op->color = color;
+}
+
+void DisplayList::asset(uint16_t x, uint16_t y, const Asset *asset) {
+  asset = assetPackResolve(asset);
+  DisplayOp *op = add(DL_OP_ASSET, x, y, asset->width, asset->height);
+  if(op != NULL)
+    op->asset = asset;
+}
+
+// Next end() draws every op in full, for when something else has drawn over the region
+void DisplayList::invalidate() {
+  valid = false;
+}
+
+bool DisplayList::sameOp(const DisplayOp *a, const DisplayOp *b) {
+  return (a->type == b->type) && (a->x == b->x) && (a->y == b->y) && (a->w == b->w) && (a->h == b->h) &&
+    (a->textx == b->textx) && (a->texty == b->texty) && (a->color == b->color) &&
+    (a->bitmap == b->bitmap) && (a->asset == b->asset) && (strcmp(a->text, b->text) == 0);
+}
+
+// The atlas glyphs sit in fixed cells, so only the cells whose character or position
+// changed need recomposing.  False when the whole box has to be drawn.
+bool DisplayList::textSpan(const DisplayOp *prev, const DisplayOp *op, Region *span) {
+#if VALUE_RENDERER == VALUE_RENDER_ATLAS
+  if((prev->type != DL_OP_TEXT) || (prev->x != op->x) || (prev->y != op->y) || (prev->w != op->w) ||
+    (prev->h != op->h) || (prev->textx != op->textx) || (prev->texty != op->texty))
+    return false;
+
+  uint8_t prevLen = strlen(prev->text);
+  uint8_t opLen = strlen(op->text);
+  int16_t prevPen = op->textx;
+  int16_t opPen = op->textx;
+  int16_t x0 = INT16_MAX;
+  int16_t x1 = INT16_MIN;
+
+  for(uint8_t n=0;n<max(prevLen, opLen);n++) {
+    char pc = (n < prevLen) ? prev->text[n] : 0;
+    char oc = (n < opLen) ? op->text[n] : 0;
+    const GlyphInfo *pg = pc ? glyphLookup(pc) : NULL;
+    const GlyphInfo *og = oc ? glyphLookup(oc) : NULL;
+    uint8_t prevAdvance = pg ? pg->advance : 0;
+    uint8_t opAdvance = og ? og->advance : 0;
+
+    if((pc != oc) || (prevPen != opPen)) {
+      if(prevAdvance) {
+        x0 = min(x0, prevPen);
+        x1 = max(x1, (int16_t)(prevPen + prevAdvance));
+      }
+      if(opAdvance) {
+        x0 = min(x0, opPen);
+        x1 = max(x1, (int16_t)(opPen + opAdvance));
+      }
+    }
+    prevPen += prevAdvance;
+    opPen += opAdvance;
+  }
+
+  x0 = max(x0, (int16_t)op->x);
+  x1 = min(x1, (int16_t)(op->x + op->w));
+  int16_t y0 = max(op->y, op->texty);
+  int16_t y1 = min(op->y + op->h, op->texty + GLYPH_HEIGHT);
+
+  span->x = x0;
+  span->y = y0;
+  span->w = (x1 > x0) ? x1 - x0 : 0;
+  span->h = (y1 > y0) ? y1 - y0 : 0;
+  return true;
+#else
+  // CGROM text is proportional and drawn over a restore, the box always goes as a whole
+  return false;
+#endif
+}
+
+void DisplayList::addDirty(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+  if((w == 0) || (h == 0))
+    return;
+
+  for(uint8_t n=0;n<dirtyCount;n++) {
+    if((x >= dirty[n].x) && (y >= dirty[n].y) &&
+      ((x + w) <= (dirty[n].x + dirty[n].w)) && ((y + h) <= (dirty[n].y + dirty[n].h)))
+      return;
+  }
+
+  if(dirtyCount == DL_MAX_DIRTY) {
+    allDirty = true;
+    return;
+  }
+
+  dirty[dirtyCount].x = x;
+  dirty[dirtyCount].y = y;
+  dirty[dirtyCount].w = w;
+  dirty[dirtyCount].h = h;
+  dirtyCount++;
+}
+
+bool DisplayList::clipToOp(const DisplayOp *op, const Region *r, Region *clip) {
+  int16_t x0 = max(op->x, r->x);
+  int16_t y0 = max(op->y, r->y);
+  int16_t x1 = min(op->x + op->w, r->x + r->w);
+  int16_t y1 = min(op->y + op->h, r->y + r->h);
+
+  if((x1 <= x0) || (y1 <= y0))
+    return false;
+
+  clip->x = x0;
+  clip->y = y0;
+  clip->w = x1 - x0;
+  clip->h = y1 - y0;
+  return true;
+}
+
+bool DisplayList::overlapsDirty(const DisplayOp *op) {
+  Region clip;
+  for(uint8_t n=0;n<dirtyCount;n++) {
+    if(clipToOp(op, &dirty[n], &clip))
+      return true;
+  }
+  return false;
+}
+
+// A text op recomposes its box from the background, so nothing under it needs restoring.
+// Segments leave the rest of the box alone.
+bool DisplayList::coveredByText(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+#if VALUE_RENDERER != VALUE_RENDER_SEGMENT
+  for(uint8_t n=0;n<count[current];n++) {
+    const DisplayOp *op = &ops[current][n];
+    if((op->type == DL_OP_TEXT) && (x >= op->x) && (y >= op->y) &&
+      ((x + w) <= (op->x + op->w)) && ((y + h) <= (op->y + op->h)))
+      return true;
+  }
+#endif
+  return false;
+}
+
+bool DisplayList::insideBox(const DisplayOp *box, const DisplayOp *op) {
+  return (op->x >= box->x) && (op->y >= box->y) &&
+    ((op->x + op->w) <= (box->x + box->w)) && ((op->y + op->h) <= (box->y + box->h));
+}
+
+// The atlas compositor draws the assets inside a text box along with the text, they are
+// never drawn on their own
+bool DisplayList::composedIntoText(uint8_t index) {
+#if VALUE_RENDERER == VALUE_RENDER_ATLAS
+  const DisplayOp *op = &ops[current][index];
+  if(op->type != DL_OP_ASSET)
+    return false;
+
+  for(uint8_t n=0;n<index;n++) {
+    if((ops[current][n].type == DL_OP_TEXT) && insideBox(&ops[current][n], op))
+      return true;
+  }
+#endif
+  return false;
+}
+
+void DisplayList::drawText(const DisplayOp *op, const Region *r) {
+  if((r->w == 0) || (r->h == 0))
+    return;
+
+#if VALUE_RENDERER == VALUE_RENDER_ATLAS
+  ComposeIcon icons[DL_MAX_OPS];
+  uint8_t iconCount = 0;
+  for(uint8_t n=(op - ops[current])+1;n<count[current];n++) {
+    const DisplayOp *icon = &ops[current][n];
+    if((icon->type == DL_OP_ASSET) && insideBox(op, icon)) {
+      icons[iconCount].x = icon->x;
+      icons[iconCount].y = icon->y;
+      icons[iconCount].asset = icon->asset;
+      iconCount++;
+    }
+  }
+  drawComposedValue(r->x, r->y, r->w, r->h, op->textx, op->texty, op->text, icons, iconCount);
+#else
+  drawLargeValue(op->x, op->y, op->w, op->h, op->textx, op->texty, op->text);
+#endif
+  stats.pixels += (uint32_t)r->w * r->h;
+}
+
+void DisplayList::drawOp(const DisplayOp *op) {
+  Region box = {op->x, op->y, op->w, op->h};
+
+  switch(op->type) {
+    case DL_OP_TEXT:
+      drawText(op, &box);
+      break;
+    case DL_OP_BITMAP:
+      drawTransparentBitmap(op->x, op->y, op->w, op->h, op->bitmap);
+      break;
+    case DL_OP_ASSET:
+      drawAsset(op->x, op->y, op->asset);
+      break;
+    case DL_OP_RECT:
+      waitDisplayIdle();
+      tft->graphicsMode();
+      tft->fillRect(op->x, op->y, op->w, op->h, op->color);
+      break;
+    default:
+      break;
+  }
+}
+
+void DisplayList::end() {
+  DisplayOp *now = ops[current];
+  DisplayOp *prev = ops[current ^ 1];
+  uint8_t n = count[current];
+  uint8_t prevCount = valid ? count[current ^ 1] : 0;
+  bool changed[DL_MAX_OPS];
+  Region span[DL_MAX_OPS];
+
+  dirtyCount = 0;
+  allDirty = !valid;
+
+  // What changed this frame, and the regions it rewrites.  A restore by the frame's damage
+  // pass has wiped the op, so it goes again in full.
+  for(uint8_t i=0;i<n;i++) {
+    Region box = {now[i].x, now[i].y, now[i].w, now[i].h};
+    bool damaged = damageOverlaps(box.x, box.y, box.w, box.h);
+
+    changed[i] = damaged || (i >= prevCount) || !sameOp(&prev[i], &now[i]);
+    if(!changed[i])
+      continue;
+
+    if((now[i].type != DL_OP_TEXT) || damaged || (i >= prevCount) || !textSpan(&prev[i], &now[i], &span[i]))
+      span[i] = box;
+    addDirty(span[i].x, span[i].y, span[i].w, span[i].h);
+  }
+
+  // Ops that moved or went away leave their old bounds behind
+  for(uint8_t i=0;i<prevCount;i++) {
+    if((i < n) && (!changed[i] || ((prev[i].type == DL_OP_TEXT) && (now[i].type == DL_OP_TEXT))))
+      continue;
+
+    if(!coveredByText(prev[i].x, prev[i].y, prev[i].w, prev[i].h))
+      redrawBackgroundSection(prev[i].x, prev[i].y, prev[i].w, prev[i].h);
+    addDirty(prev[i].x, prev[i].y, prev[i].w, prev[i].h);
+  }
+
+#if VALUE_RENDERER == VALUE_RENDER_CGROM
+  // CGROM text can only be redrawn whole, which in turn rewrites the rest of its box
+  bool grew = true;
+  while(grew && !allDirty) {
+    grew = false;
+    for(uint8_t i=0;i<n;i++) {
+      if((now[i].type == DL_OP_TEXT) && !changed[i] && overlapsDirty(&now[i])) {
+        changed[i] = true;
+        span[i].x = now[i].x;
+        span[i].y = now[i].y;
+        span[i].w = now[i].w;
+        span[i].h = now[i].h;
+        addDirty(span[i].x, span[i].y, span[i].w, span[i].h);
+        grew = true;
+      }
+    }
+  }
+#endif
+
+  for(uint8_t i=0;i<n;i++) {
+    const DisplayOp *op = &now[i];
+
+    if(composedIntoText(i)) {
+      stats.opsSkipped++;
+      continue;
+    }
+
+    if(allDirty) {
+      drawOp(op);
+      stats.opsDrawn++;
+      continue;
+    }
+
+    if(op->type == DL_OP_TEXT) {
+      bool drawn = changed[i];
+      if(changed[i])
+        drawText(op, &span[i]);
+
+      // Recompose whatever other ops rewrote inside the box
+      for(uint8_t d=0;d<dirtyCount;d++) {
+        Region clip;
+        if(!clipToOp(op, &dirty[d], &clip))
+          continue;
+
+        if(changed[i] && (clip.x >= span[i].x) && (clip.y >= span[i].y) &&
+          (clip.x + clip.w <= span[i].x + span[i].w) && (clip.y + clip.h <= span[i].y + span[i].h))
+          continue;
+
+        drawText(op, &clip);
+        drawn = true;
+      }
+
+      if(drawn)
+        stats.opsDrawn++;
+      else
+        stats.opsSkipped++;
+    } else if(changed[i] || overlapsDirty(op)) {
+      drawOp(op);
+      stats.opsDrawn++;
+    } else {
+      stats.opsSkipped++;
+    }
+  }
+
+  valid = true;
+  current ^= 1;
+}
+
+const DisplayListStats *DisplayList::getStats() {
+  return &stats;
+}
+
+void DisplayList::resetStats() {
+  memset(&stats, 0, sizeof(stats));
+}
@@ -25,43 +25,157 @@
 #include "ErrorPanel.h"
 #include "Adafruit_RA8875.h"
 #include "display.h"
+#include "Layout.h"
+#include "ecoconsole.h"
 
 ErrorPanel::ErrorPanel(Adafruit_RA8875 *_tft) {
   tft = _tft;
 
-  strcpy(messageBuffer,"Error: An Error has occured");
-  messageExists=false;
+  queueCount = 0;
+  shown = -1;
+  drawnMessage[0] = 0;
+  lastDraw = 0;
+  lastRotate = 0;
 }
 
 void ErrorPanel::draw() {
+  const char *message = (shown >= 0) ? queue[shown].message : "";
+  if(strcmp(message, drawnMessage) == 0)
+    return;
 
-  if(messageExists) {
-    tft->fillRect(0,459,799,20,RA8875_RED);
+  waitDisplayIdle();
+  if(shown >= 0) {
+    tft->fillRect(ERROR_X,ERROR_Y,ERROR_WIDTH,ERROR_HEIGTH,RA8875_RED);
 
-    tft->textMode();
-    tft->textTransparent(RA8875_WHITE);
-
-    uint16_t xPos = 400 - (strlen(messageBuffer)/2 *10);
-    tft->textSetCursor(xPos,459);
-
-    printString(messageBuffer);
+    // A message wider than the 480x272 bar starts at the left edge
+    int16_t xPos = SCREEN_WIDTH/2 - (strlen(message)/2 *10);
+    if(xPos < 0)
+      xPos = 0;
+    queueString(xPos,ERROR_Y,FONT_INTERNAL,0,RA8875_WHITE,message);
   } else {
-    redrawBackgroundSection(0,459,799,20);
+    redrawBackgroundSection(ERROR_X,ERROR_Y,ERROR_WIDTH,ERROR_HEIGTH);
   }
+
+  strcpy(drawnMessage, message);
+  lastDraw = millis();
 }
 
-void ErrorPanel::setMessage(const char *error) {
-  Serial.print("Err Set Message ");Serial.println(error);
+void ErrorPanel::update() {
+  uint32_t now = millis();
+
+  expire();
+
+  bool rotate = (now - lastRotate) >= ERROR_ROTATE_MS;
+  if(rotate)
+    lastRotate = now;
+  pickShown(rotate);
+
+  if((now - lastDraw) < ERROR_REDRAW_MS)
+    return;
 
-  strncpy(messageBuffer,error, 69);
-  if(strlen(error)>69)
-    messageBuffer[70] = '\0';
-    
-  messageExists=true;
   draw();
 }
 
+void ErrorPanel::setMessage(const char *error, uint8_t severity) {
+  int8_t n = findMessage(error);
+  if(n >= 0) {
+    queue[n].count++;
+    queue[n].lastSeen = millis();
+    if(severity > queue[n].severity)
+      queue[n].severity = severity;
+    return;
+  }
+
+  Serial.print("Err Set Message ");Serial.println(error);
+
+  // A full queue drops its least severe, longest quiet entry, unless that outranks this one
+  if(queueCount == ERROR_QUEUE_LEN) {
+    uint8_t victim = 0;
+    for(uint8_t i=1;i<queueCount;i++) {
+      if((queue[i].severity < queue[victim].severity) ||
+        ((queue[i].severity == queue[victim].severity) && (queue[i].lastSeen < queue[victim].lastSeen)))
+        victim = i;
+    }
+
+    if(queue[victim].severity > severity)
+      return;
+    removeEntry(victim);
+  }
+
+  ErrorEntry *e = &queue[queueCount++];
+  strncpy(e->message, error, ERROR_MESSAGE_LEN-1);
+  e->message[ERROR_MESSAGE_LEN-1] = '\0';
+  e->severity = severity;
+  e->count = 1;
+  e->lastSeen = millis();
+
+  if(severity == ERROR_CRITICAL) {
+    pickShown(false);
+    draw();
+    waitDisplayIdle();          // Out now, the caller may not get back to displayLoop()
+  }
+}
+
 void ErrorPanel::clearMessage() {
-  messageExists=false;
-  draw();
-}
\ No newline at end of file
+  queueCount = 0;
+  shown = -1;
+}
+
+int8_t ErrorPanel::findMessage(const char *error) {
+  for(uint8_t n=0;n<queueCount;n++) {
+    if(strncmp(queue[n].message, error, ERROR_MESSAGE_LEN-1) == 0)
+      return n;
+  }
+  return -1;
+}
+
+void ErrorPanel::removeEntry(uint8_t n) {
+  for(uint8_t i=n;i<queueCount-1;i++)
+    queue[i] = queue[i+1];
+  queueCount--;
+
+  if(shown == n)
+    shown = -1;
+  else if(shown > n)
+    shown--;
+}
+
+// Only errors that keep being reported can tell us they stopped.  Critical and one shot
+// errors stay until clearError().
+void ErrorPanel::expire() {
+  uint32_t now = millis();
+
+  for(int8_t n=queueCount-1;n>=0;n--) {
+    if((queue[n].severity == ERROR_CRITICAL) || (queue[n].count < 2))
+      continue;
+
+    if((now - queue[n].lastSeen) > ERROR_EXPIRE_MS) {
+      Serial.printf("Err Expired %s, reported %u times\n", queue[n].message, queue[n].count);
+      removeEntry(n);
+    }
+  }
+}
+
+// Keep showing the current entry unless it is time to rotate or something more severe
+// arrived, then move on to the next entry of the highest severity
+void ErrorPanel::pickShown(bool rotate) {
+  if(queueCount == 0) {
+    shown = -1;
+    return;
+  }
+
+  uint8_t top = 0;
+  for(uint8_t n=0;n<queueCount;n++)
+    top = max(top, queue[n].severity);
+
+  if((shown >= 0) && !rotate && (queue[shown].severity == top))
+    return;
+
+  for(uint8_t i=1;i<=queueCount;i++) {
+    uint8_t n = (shown + i + queueCount) % queueCount;
+    if(queue[n].severity == top) {
+      shown = n;
+      return;
+    }
+  }
+}
@@ -29,35 +29,102 @@
 #include "time.h"
 #include "WiFi.h"
 
+#define HEADER_CHAR_WIDTH 8     // Internal CGROM font, enlarge 0
+#define HEADER_CHAR_HEIGHT 16
+#define HEADER_DATE_X (SCREEN_WIDTH-90)
+#define HEADER_TIME_X (SCREEN_WIDTH/2-20)
+#define BATTERY_X 25
+
 HeaderPanel::HeaderPanel(Adafruit_RA8875 *_tft) {
   tft = _tft;
 
-  configTime(GMT_OFFSET_SECS, DAYLIGHT_OFFSET_SECS, "pool.ntp.org");
   strcpy(timeBuffer,"00:00");
   strcpy(dateBuffer, "00/00/00");
   battery_level = 3.3;
 
+  drawnTime[0] = 0;
+  drawnDate[0] = 0;
+  drawnBattery = -1;
+  drawnBatteryColor = RA8875_WHITE;
+  lastMinute = 0;
+  barDirty = true;
 }
 
-void HeaderPanel::draw() {
+// The panel is statically allocated, SNTP can't be started before setup()
+void HeaderPanel::begin() {
+  configTime(GMT_OFFSET_SECS, DAYLIGHT_OFFSET_SECS, "pool.ntp.org");
+}
+
+// Called from displayLoop(), the header only needs a frame when the minute rolls over
+void HeaderPanel::update() {
+  time_t minute = time(NULL) / 60;
+  if(minute == lastMinute)
+    return;
+
+  lastMinute = minute;
   fillDateTimeBuffers();
-  tft->fillRect(0,0,799,20,RA8875_WHITE);
+  if(strcmp(timeBuffer, drawnTime) || strcmp(dateBuffer, drawnDate))
+    schedulePanel(this, false);
+}
 
-  tft->textMode();
-  tft->textEnlarge(0);
-  tft->textTransparent(RA8875_BLACK);
+void HeaderPanel::draw() {
+  waitDisplayIdle();
+
+  if(barDirty) {
+    tft->fillRect(0,0,SCREEN_WIDTH-1,20,RA8875_WHITE);
+    drawnTime[0] = 0;
+    drawnDate[0] = 0;
+    drawnBattery = -1;
+    barDirty = false;
+  }
 
-  if(strlen(timeBuffer)==5)
-    tft->textSetCursor(380,1);
-  else
-    tft->textSetCursor(390,1);
+  if(batteryChanged())
+    drawBattery();
 
-  printString(timeBuffer);
+  // The date only changes at midnight.  Every cell is cleared before any text is queued,
+  // the fills can't go out while the CGROM works through the queue.
+  bool dateChanged = strcmp(dateBuffer, drawnDate) != 0;
+  if(dateChanged && (drawnDate[0] != 0))
+    tft->fillRect(HEADER_DATE_X,1,strlen(drawnDate)*HEADER_CHAR_WIDTH,HEADER_CHAR_HEIGHT,RA8875_WHITE);
 
-  tft->textSetCursor(710,1);
-  printString(dateBuffer);
+  drawTime();
 
-  tft->graphicsMode();
+  if(dateChanged) {
+    queueString(HEADER_DATE_X,1,FONT_INTERNAL,0,RA8875_BLACK,dateBuffer);
+    strcpy(drawnDate, dateBuffer);
+  }
+}
+
+// The time is fixed width, so a changed character is a white cell and one glyph.  A change
+// of length moves the whole string.
+void HeaderPanel::drawTime() {
+  uint16_t x = (strlen(timeBuffer)==5) ? HEADER_TIME_X : HEADER_TIME_X+10;
+
+  if(strlen(timeBuffer) != strlen(drawnTime)) {
+    if(drawnTime[0] != 0)
+      tft->fillRect(HEADER_TIME_X,1,5*HEADER_CHAR_WIDTH,HEADER_CHAR_HEIGHT,RA8875_WHITE);
+    drawnTime[0] = 0;
+  }
+
+  bool changed[sizeof(timeBuffer)];
+  for(uint8_t n=0;timeBuffer[n]!=0;n++) {
+    changed[n] = (drawnTime[0] == 0) || (timeBuffer[n] != drawnTime[n]);
+    if(changed[n] && (drawnTime[0] != 0))
+      tft->fillRect(x + n*HEADER_CHAR_WIDTH,1,HEADER_CHAR_WIDTH,HEADER_CHAR_HEIGHT,RA8875_WHITE);
+  }
+
+  for(uint8_t n=0;timeBuffer[n]!=0;n++) {
+    if(!changed[n])
+      continue;
+
+    char c[2] = {timeBuffer[n], 0};
+    queueString(x + n*HEADER_CHAR_WIDTH,1,FONT_INTERNAL,0,RA8875_BLACK,c);
+  }
+
+  strcpy(drawnTime, timeBuffer);
+}
+
+uint8_t HeaderPanel::batteryOffset() {
   float level = battery_level;
   if (level > 3.3)
     level = 3.3;
@@ -65,22 +132,41 @@ void HeaderPanel::draw() {
   if (level < 2.4)
     level = 2.4;
   
-  uint8_t offset = uint8_t(((level - 2.1) * 100.0)/6.0);
+  return uint8_t(((level - 2.1) * 100.0)/6.0);
+}
 
+uint16_t HeaderPanel::batteryColor() {
   uint16_t color = RA8875_GREEN;
-  if(level < 3.0)
+  if(battery_level < 3.0)
     color = RA8875_YELLOW;
-  if (level < 2.5)
+  if (battery_level < 2.5)
     color = RA8875_RED;
 
-  tft->fillRect(48-offset,4,offset +1, 12, color);
+  return color;
+}
+
+void HeaderPanel::drawBattery() {
+  uint8_t offset = batteryOffset();
+
+  tft->graphicsMode();
+  tft->fillRect(BATTERY_X,0,battery_asset.width,battery_asset.height,RA8875_WHITE);
+  tft->fillRect(48-offset,4,offset +1, 12, batteryColor());
 
-  drawTransparentBitmap(25,0,28,20,battery);
+  drawAsset(BATTERY_X,0,&battery_asset);
+  drawnBattery = offset;
+  drawnBatteryColor = batteryColor();
+}
 
+bool HeaderPanel::batteryChanged() {
+  return (drawnBattery != batteryOffset()) || (drawnBatteryColor != batteryColor());
 }
 
+// Only a new gauge length or colour is worth a frame
 void HeaderPanel::setBatteryLevel(float level) {
   battery_level = level;
+  if(batteryChanged())
+    schedulePanel(this, false);
+
   if(level < 2.5) {
     char errStr[70];
     sprintf(errStr,"Voltage Level %f is below 2.5 V",level);
@@ -94,7 +180,7 @@ void HeaderPanel::fillDateTimeBuffers() {
   if(WiFi.status() != WL_CONNECTED)
     return;
 
-  if(getLocalTime(&dt)) {
+  if(getLocalTime(&dt, 0)) {     // Don't wait for NTP, the next minute tries again
     strftime(timeBuffer,6,"%I:%M",&dt);
     strftime(dateBuffer,9,"%D",&dt);
   } else {
@@ -102,7 +188,7 @@ void HeaderPanel::fillDateTimeBuffers() {
     strcpy(dateBuffer, "XX/XX/XX");
     char errStr[70];
     sprintf(errStr,"Error getting local time");
-    setError(errStr);
+    raiseError(errStr, ERROR_INFO);
   }
 }
 
@@ -49,72 +49,51 @@ HumidityPanel::HumidityPanel(Adafruit_RA8875 *_tft, uint16_t _x, uint16_t _y, in
 void HumidityPanel::draw() {
 
   if(borderDirty) {
-    tft->graphicsMode();
-    tft->drawLine(x_org,y_org, x_org,y_org+HUM_HEIGTH-25,RA8875_YELLOW); // Left
-    tft->drawLine(x_org+HUM_WIDTH,y_org, x_org+HUM_WIDTH,y_org+HUM_HEIGTH-25,RA8875_YELLOW); // Right
-    tft->drawLine(x_org+25,y_org+HUM_HEIGTH, x_org+HUM_WIDTH-25,y_org+HUM_HEIGTH,RA8875_YELLOW); //Bottom
-    tft->drawCurve(x_org+25, y_org+HUM_HEIGTH-25, 25, 25,0,RA8875_YELLOW);
-    tft->drawCurve(x_org+HUM_WIDTH-25, y_org+HUM_HEIGTH-25, 25, 25,3,RA8875_YELLOW);
-
-    redrawBackgroundSection(x_org + 3, y_org +3, HUM_WIDTH - 25, 20);
-    tft->textMode();
-    tft->textTransparent(RA8875_WHITE);    
-    tft->textEnlarge(0);
-
-
-    if (indoor) {
-      tft->textSetCursor(x_org+(HUM_WIDTH-154)/2, y_org+3);
-      printString("Indoor Humidity");
-    }
-    else{
-      tft->textSetCursor(x_org+(HUM_WIDTH-160)/2, y_org+3);
-      printString("Outdoor ");
+    waitDisplayIdle();
+    if(!chromeBaked())
+      drawChrome(x_org, y_org, humChrome, CHROME_COUNT(humChrome), CHROME_BORDER, indoor);
+
+    // Only the word after HUM_TITLE_OUTDOOR changes with the mode
+    if (!indoor) {
+      redrawBackgroundSection(x_org + HUM_TITLE_MODE_X, y_org + PANEL_TITLE_Y, HUM_TITLE_MODE_WIDTH, PANEL_TITLE_HEIGTH);
       if(displayMode == HUM_MODE)
-        printString("Humidity");
+        queueString(x_org + HUM_TITLE_MODE_X, y_org+PANEL_TITLE_Y, FONT_INTERNAL, 0, RA8875_WHITE, "Humidity");
       else 
-        printString("Dew Point");
+        queueString(x_org + HUM_TITLE_MODE_X, y_org+PANEL_TITLE_Y, FONT_INTERNAL, 0, RA8875_WHITE, "Dew Point");
     }
     
     borderDirty = false;
   }
 
   if(humDirty) {
-    uint16_t xoffset = 60;
-    uint16_t yoffset = 30;   
-    
-    redrawBackgroundSection(x_org + xoffset - 20, y_org + yoffset, HUM_WIDTH - 75, 75);
-    setArialFont();
-    tft->textEnlarge(1);
+    uint16_t xoffset = HUM_TEXT_X;
+    uint16_t yoffset = HUM_TEXT_Y;
     
 
     if(displayMode == HUM_MODE) {
       if(abs(humidity) < 10) {
-        xoffset+=38;
+        xoffset+=VALUE_SCALE(38);
       }
 
       
-      tft->textSetCursor(x_org + xoffset, y_org + yoffset);
-
-      char buffer[5];
+      char buffer[6];
       itoa(humidity,buffer,10);
-      printString(buffer);
-      printString("%");
+      strcat(buffer,"%");
+      drawLargeValue(x_org + HUM_VALUE_X, y_org + HUM_VALUE_Y, HUM_VALUE_WIDTH, HUM_VALUE_HEIGTH, x_org + xoffset, y_org + yoffset, buffer);
 
       humDirty = false;
     } else {  // Dew Point Display
   
-      xoffset = 90;
+      xoffset = HUM_DEW_TEXT_X;
 
       if(abs(dewPoint) < 10) {
-        xoffset+=38;
+        xoffset+=VALUE_SCALE(38);
       }
 
       
-      tft->textSetCursor(x_org + xoffset, y_org + yoffset);
-
       char buffer[5];
       itoa(dewPoint,buffer,10);
-      printString(buffer);
+      drawLargeValue(x_org + HUM_VALUE_X, y_org + HUM_VALUE_Y, HUM_VALUE_WIDTH, HUM_VALUE_HEIGTH, x_org + xoffset, y_org + yoffset, buffer);
 
       humDirty = false;
     }
@@ -127,49 +106,46 @@ void HumidityPanel::draw() {
   }
 }
 
-void HumidityPanel::drawExtremes() {
+void HumidityPanel::reportDamage() {
+  if(borderDirty && !indoor)
+    addDamage(x_org + HUM_TITLE_MODE_X, y_org + PANEL_TITLE_Y, HUM_TITLE_MODE_WIDTH, PANEL_TITLE_HEIGTH);
 
-  redrawBackgroundSection(x_org+ 1, y_org+HUM_XTREME_YOFFSET, HUM_WIDTH-1, 49);
+  if(humDirty)
+    addValueDamage(x_org + HUM_VALUE_X, y_org + HUM_VALUE_Y, HUM_VALUE_WIDTH, HUM_VALUE_HEIGTH);
 
-  tft->textMode();
-  tft->textTransparent(RA8875_WHITE);
-  
-  tft->textEnlarge(0);
+  if(extremeDirty)
+    addDamage(x_org+ 1, y_org+HUM_XTREME_YOFFSET, HUM_WIDTH-1, XTREME_HEIGTH);
+}
+
+void HumidityPanel::drawExtremes() {
+
+  redrawBackgroundSection(x_org+ 1, y_org+HUM_XTREME_YOFFSET, HUM_WIDTH-1, XTREME_HEIGTH);
 
-  tft->textSetCursor(x_org+25,y_org+HUM_XTREME_YOFFSET);
-  printString("Low");
-  tft->textSetCursor(x_org+HUM_WIDTH-27-32,y_org+HUM_XTREME_YOFFSET);
-  printString("High");
+  if(!chromeBaked())
+    drawChrome(x_org, y_org, humChrome, CHROME_COUNT(humChrome), CHROME_EXTREMES, indoor);
 
-  //Character Width = 8 Space =2
-  setSmallArialFont();
   switch(highlow) {
     case DAILY:
       getDailyExtremes();
-      tft->textSetCursor(x_org+(HUM_WIDTH/2)-24,y_org+HUM_XTREME_YOFFSET+15);
-      printString("Daily");
       break;
     case WEEKLY:
       getExtendedExtremes(7);
-      tft->textSetCursor(x_org+(HUM_WIDTH/2)-29,y_org+HUM_XTREME_YOFFSET+15);
-      printString("Weekly");
       break;
     case MONTHLY:
       getExtendedExtremes(30);
-      tft->textSetCursor(x_org+(HUM_WIDTH/2)-34,y_org+HUM_XTREME_YOFFSET+15);
-      printString("Monthly");
       break;
     case YEARLY:
       getExtendedExtremes(365);
-      tft->textSetCursor(x_org+(HUM_WIDTH/2)-29,y_org+HUM_XTREME_YOFFSET+15);
-      printString("Yearly");
       break;      
     default:
       break;
   }
+
+  const PeriodLabel *label = &xtremeLabels[highlow];
+  queueString(x_org+(HUM_WIDTH/2)-label->half,y_org+HUM_XTREME_YOFFSET+XTREME_VALUE_Y,FONT_SMALL_ARIAL,0,RA8875_WHITE,label->text);
   
-  drawCenteredArial((3*8)/2+25+x_org,y_org+HUM_XTREME_YOFFSET+15,low);
-  drawCenteredArial(x_org+(HUM_WIDTH -27 -(4*8)/2),y_org+HUM_XTREME_YOFFSET+15,high);
+  drawCenteredArial(x_org+XTREME_LOW_CENTER,y_org+HUM_XTREME_YOFFSET+XTREME_VALUE_Y,low);
+  drawCenteredArial(x_org+XTREME_HIGH_CENTER(HUM_WIDTH),y_org+HUM_XTREME_YOFFSET+XTREME_VALUE_Y,high);
 }
 
 bool HumidityPanel::isClicked(uint16_t x, uint16_t y) {
@@ -204,7 +180,7 @@ bool HumidityPanel::isClicked(uint16_t x, uint16_t y) {
       }
     }
 
-    draw();
+    schedulePanel(this, true);
     return true;
   }
 
@@ -24,6 +24,7 @@
 #include <Arduino.h>
 #include <HTTPClient.h>
 #include "InfluxDBQueries.h"
+#include "ecoconsole.h"
 #include "display.h"
 #include "time.h"
 
@@ -93,7 +94,7 @@ uint16_t influxGetFloatMaxMin(const char *column, uint16_t days, float *high, fl
   {
     char error[50];
     sprintf(error,"Getting MAX %s returned %d",column,n);
-    setError(error);
+    raiseError(error, ERROR_INFO);
 
     return n;
   }
@@ -105,7 +106,7 @@ uint16_t influxGetFloatMaxMin(const char *column, uint16_t days, float *high, fl
   {
     char error[50];
     sprintf(error,"Getting MIN %s returned %d",column,n);
-    setError(error);
+    raiseError(error, ERROR_INFO);
   }
   return n;
 
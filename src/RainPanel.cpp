@@ -46,63 +46,34 @@ void RainPanel::draw() {
   float current;
 
   if(borderDirty) {
-    tft->graphicsMode();
-    tft->drawLine(x_org+25,y_org, x_org+RAIN_WIDTH-25,y_org,RA8875_YELLOW); // Top
-    tft->drawLine(x_org,y_org+25, x_org,y_org+RAIN_HEIGTH,RA8875_YELLOW); // Left
-    tft->drawLine(x_org+RAIN_WIDTH,y_org+25, x_org+RAIN_WIDTH,y_org+RAIN_HEIGTH,RA8875_YELLOW); // Right
-    tft->drawLine(x_org,y_org+RAIN_HEIGTH, x_org+RAIN_WIDTH,y_org+RAIN_HEIGTH,RA8875_YELLOW); //Bottom
-    tft->drawCurve(x_org+25, y_org+25, 25, 25,1,RA8875_YELLOW);
-    tft->drawCurve(x_org+RAIN_WIDTH-25, y_org+25, 25, 25,2,RA8875_YELLOW);
-
-    drawTransparentBitmap(x_org+210,y_org+45,50,50,rain);
-
-    tft->textMode();
-    tft->textTransparent(RA8875_WHITE);
-    tft->textEnlarge(0);
-    tft->textSetCursor(x_org+(RAIN_WIDTH - 100)/2, y_org+3);
-    printString("Rain Gauge");
+    waitDisplayIdle();
+    if(!chromeBaked())
+      drawChrome(x_org, y_org, rainChrome, CHROME_COUNT(rainChrome), CHROME_BORDER, false);
+
+    drawAsset(x_org+RAIN_ICON_X,y_org+RAIN_ICON_Y,&rain_asset);
     borderDirty = false;
   }
 
   if(rainDirty) {
     struct tm dt;
-    redrawBackgroundSection(x_org+ 10, y_org+40, RAIN_WIDTH-90, RAIN_HEIGTH - 42);
-
-    tft->textMode();
-
-    setSmallArialFont();
-    tft->textTransparent(RA8875_WHITE);
-    tft->textEnlarge(0);
-
     switch(rainPeriod) {
       case DAILY:
         current = drain;
-        tft->textSetCursor(x_org+(RAIN_WIDTH/2)-(7*8/2),y_org+100);
-        printString("24 Hour");
         break;
       case WEEKLY:
         current = wrain;
-        tft->textSetCursor(x_org+(RAIN_WIDTH/2)-(6*8/2),y_org+100);
-        printString("7 Days");
         break;
       case MONTHLY:
         current = mrain;
-        tft->textSetCursor(x_org+(RAIN_WIDTH/2)-(13*8/2),y_org+100);
-        printString("Month to Date");
         break;
       case YEARLY:
         current = yrain;
-        tft->textSetCursor(x_org+(RAIN_WIDTH/2)-(12*8/2),y_org+100);
-        printString("Year to Date");
-        break;      
+        break;
       default:
+        current = drain;
         break;
     }
 
-    setArialFont();
-    tft->textEnlarge(1);
-    tft->textSetCursor(x_org+30,y_org+30);
-
     char buffer[6];
     if(current < 10) {
       sprintf(buffer,"%3.2f\"",current);
@@ -111,13 +82,25 @@ void RainPanel::draw() {
     } else {
       sprintf(buffer, "%3.0f\"",current);
     }
-    printString(buffer);
+
+    // The value box starts at the top of the text cell and takes the period label with it
+    drawLargeValue(x_org+RAIN_VALUE_X, y_org+RAIN_VALUE_Y, RAIN_VALUE_WIDTH, RAIN_VALUE_HEIGTH, x_org+RAIN_TEXT_X, y_org+RAIN_TEXT_Y, buffer);
+
+    redrawValueBoxSection(x_org+RAIN_VALUE_X, y_org+RAIN_PERIOD_Y, RAIN_VALUE_WIDTH, RAIN_PERIOD_HEIGTH);
+
+    const PeriodLabel *label = &rainLabels[rainPeriod];
+    queueString(x_org+(RAIN_WIDTH/2)-label->half,y_org+RAIN_PERIOD_Y,FONT_SMALL_ARIAL,0,RA8875_WHITE,label->text);
 
     rainDirty = false;
   }
 
 }
 
+void RainPanel::reportDamage() {
+  if(rainDirty)
+    addValueDamage(x_org+RAIN_VALUE_X, y_org+RAIN_VALUE_Y, RAIN_VALUE_WIDTH, RAIN_VALUE_HEIGTH);
+}
+
 void RainPanel::setDailyRain(float _rain) {
   if (_rain != drain) {
     drain = _rain;
@@ -172,7 +155,7 @@ bool RainPanel::isClicked(uint16_t x, uint16_t y) {
 
     rainDirty = true;
 
-    draw();
+    schedulePanel(this, true);
     return true;
   }
 
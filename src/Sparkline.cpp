@@ -0,0 +1,113 @@
+/**
+ *  @filename   :   Sparkline.cpp
+ *  @brief      :   ESP32 Ecowitt Weather Station Console, scrolling history sparkline
+ *
+ *  @author     :   Kevin Kessler
+ *
+ * Copyright (C) 2024 Kevin Kessler
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <Arduino.h>
+#include "Adafruit_RA8875.h"
+#include "display.h"
+#include "Sparkline.h"
+
+Sparkline::Sparkline(Adafruit_RA8875 *_tft, uint16_t _x, uint16_t _y) {
+  tft = _tft;
+  x = _x;
+  y = _y;
+  head = 0;
+  count = 0;
+  pending = 0;
+  lastColumn = 0;
+  lo = 0;
+  hi = 0;
+  full = true;
+}
+
+// The first value starts the plot, after that a column is taken every SPARK_COLUMN_MS
+bool Sparkline::sample(float value) {
+  if((count > 0) && ((millis() - lastColumn) < SPARK_COLUMN_MS))
+    return false;
+
+  lastColumn = millis();
+  ring[head] = value;
+  head = (head + 1) % SPARK_WIDTH;
+  if(count < SPARK_WIDTH)
+    count++;
+  pending++;
+  return true;
+}
+
+// Column n counted from the oldest
+float Sparkline::column(uint8_t n) {
+  return ring[(head + SPARK_WIDTH - count + n) % SPARK_WIDTH];
+}
+
+void Sparkline::scale(int16_t *newLo, int16_t *newHi) {
+  float minValue = column(0);
+  float maxValue = minValue;
+
+  for(uint8_t n=1;n<count;n++) {
+    minValue = min(minValue, column(n));
+    maxValue = max(maxValue, column(n));
+  }
+
+  *newLo = (int16_t)floorf(minValue);
+  *newHi = (int16_t)ceilf(maxValue);
+  if(*newHi - *newLo < SPARK_MIN_SPAN)
+    *newHi = *newLo + SPARK_MIN_SPAN;
+}
+
+uint16_t Sparkline::plotY(float value) {
+  return y + (SPARK_HEIGTH-1) - (uint16_t)((value - lo) * (SPARK_HEIGTH-1) / (hi - lo) + 0.5);
+}
+
+// Newest on the right, each column a line up or down from the one before
+void Sparkline::drawColumn(uint8_t n) {
+  uint16_t px = x + SPARK_WIDTH - count + n;
+  uint16_t y1 = plotY(column(n));
+  uint16_t y0 = (n > 0) ? plotY(column(n-1)) : y1;
+
+  tft->drawFastVLine(px, min(y0, y1), abs(y1 - y0) + 1, SPARK_COLOR);
+}
+
+void Sparkline::draw() {
+  if(count == 0)
+    return;
+
+  int16_t newLo, newHi;
+  scale(&newLo, &newHi);
+
+  waitDisplayIdle();
+  tft->graphicsMode();
+
+  if(full || (pending > 1) || (newLo != lo) || (newHi != hi)) {
+    lo = newLo;
+    hi = newHi;
+    tft->fillRect(x, y, SPARK_WIDTH, SPARK_HEIGTH, SPARK_BACKGROUND);
+    for(uint8_t n=0;n<count;n++)
+      drawColumn(n);
+    full = false;
+  } else if(pending == 1) {
+    moveRect(x+1, y, SPARK_WIDTH-1, SPARK_HEIGTH, x, y);
+    tft->drawFastVLine(x+SPARK_WIDTH-1, y, SPARK_HEIGTH, SPARK_BACKGROUND);
+    drawColumn(count-1);
+  }
+
+  pending = 0;
+}
@@ -28,7 +28,8 @@
 #include "InfluxDBQueries.h"
 
 
-TemperaturePanel::TemperaturePanel(Adafruit_RA8875 *_tft, uint16_t _x, uint16_t _y, float _current, bool _indoor) {
+TemperaturePanel::TemperaturePanel(Adafruit_RA8875 *_tft, uint16_t _x, uint16_t _y, float _current, bool _indoor) :
+  valueList(_tft), history(_tft, _x + TEMP_SPARK_X, _y + TEMP_SPARK_Y) {
 
   tft = _tft;
   x_org = _x;
@@ -49,6 +50,7 @@ TemperaturePanel::TemperaturePanel(Adafruit_RA8875 *_tft, uint16_t _x, uint16_t
   tempDirty = true;
   borderDirty = true;
   extremeDirty = true;
+  historyDirty = false;
   hasData=false;
   
 }
@@ -56,6 +58,9 @@ TemperaturePanel::TemperaturePanel(Adafruit_RA8875 *_tft, uint16_t _x, uint16_t
 void TemperaturePanel::setTemperature(float _temperature) {
   hasData=true;
 
+  if(history.sample(_temperature))
+    historyDirty = true;
+
   int rndTemp = int(temperature * 10);
   int rndNewTemp = int(_temperature *10);
 
@@ -114,79 +119,59 @@ void TemperaturePanel::setFeelsLike(float _feels_like) {
 void TemperaturePanel::draw() {
 
   if(borderDirty) {
-    tft->graphicsMode();
-    tft->drawLine(x_org+25,y_org, x_org+TEMP_WIDTH-25,y_org,RA8875_YELLOW); // Top
-    tft->drawLine(x_org,y_org+25, x_org,y_org+TEMP_HEIGTH,RA8875_YELLOW); // Left
-    tft->drawLine(x_org+TEMP_WIDTH,y_org+25, x_org+TEMP_WIDTH,y_org+TEMP_HEIGTH,RA8875_YELLOW); // Right
-    tft->drawLine(x_org,y_org+TEMP_HEIGTH, x_org+TEMP_WIDTH,y_org+TEMP_HEIGTH,RA8875_YELLOW); //Bottom
-    tft->drawCurve(x_org+25, y_org+25, 25, 25,1,RA8875_YELLOW);
-    tft->drawCurve(x_org+TEMP_WIDTH-25, y_org+25, 25, 25,2,RA8875_YELLOW);
-
-    redrawBackgroundSection(x_org + 14, y_org +3, TEMP_WIDTH - 28, 20);
-    tft->textMode();
-    tft->textTransparent(RA8875_WHITE);
-    tft->textEnlarge(0);
-
-
-    if (indoor) {
-      tft->textSetCursor(x_org+(TEMP_WIDTH-172)/2, y_org+3);
-      printString("Indoor Temperature");
-    }
-    else{
-      
-      if(displayMode == TEMP_MODE) {
-        tft->textSetCursor(x_org+(TEMP_WIDTH-167)/2, y_org+3);
-        printString("Outdoor Temperature");
-      } else { 
-        tft->textSetCursor(x_org+(TEMP_WIDTH-212)/2, y_org+3);
-        printString("Feels-Like Temperature");
-      }
+    waitDisplayIdle();
+    if(!chromeBaked())
+      drawChrome(x_org, y_org, tempChrome, CHROME_COUNT(tempChrome), CHROME_BORDER, indoor);
+
+    // The indoor title is fixed and part of the chrome
+    if (!indoor) {
+      redrawBackgroundSection(x_org + PANEL_TITLE_INSET, y_org + PANEL_TITLE_Y, TEMP_WIDTH - 2*PANEL_TITLE_INSET, PANEL_TITLE_HEIGTH);
+
+      if(displayMode == TEMP_MODE)
+        queueString(x_org+TEMP_TITLE_OUTDOOR_X, y_org+PANEL_TITLE_Y, FONT_INTERNAL, 0, RA8875_WHITE, TEMP_TITLE_OUTDOOR);
+      else
+        queueString(x_org+TEMP_TITLE_FEELS_X, y_org+PANEL_TITLE_Y, FONT_INTERNAL, 0, RA8875_WHITE, TEMP_TITLE_FEELS);
     }
     borderDirty = false;
   }
 
   if(tempDirty) {
-    redrawBackgroundSection(x_org + 20, y_org + 40, TEMP_WIDTH - 50, 90);
-
-    setArialFont();
-    tft->textEnlarge(1);
-
-    uint16_t xoffset = 60;
-    uint16_t yoffset = 60;
+    uint16_t xoffset = TEMP_TEXT_X;
+    uint16_t yoffset = TEMP_TEXT_Y;
 
     if (displayMode==TEMP_MODE) {
       if(abs(temperature) < 10) {
-        xoffset+=15;
+        xoffset+=VALUE_SCALE(15);
       } else if(abs(temperature)> 99) {
-        xoffset-=25;
+        xoffset-=VALUE_SCALE(25);
       }
 
       if(temperature < 0) 
-        xoffset-=25;
+        xoffset-=VALUE_SCALE(25);
       
-      tft->textSetCursor(x_org + xoffset, y_org + yoffset);
-
       char buffer[7];
       sprintf(buffer,"%3.1f", temperature);
-      printString(buffer);
+      valueList.begin();
+      valueList.text(x_org + TEMP_VALUE_X, y_org + TEMP_VALUE_Y, TEMP_VALUE_WIDTH, TEMP_VALUE_HEIGTH, x_org + xoffset, y_org + yoffset, buffer);
+      valueList.end();
 
       //drawThermometer(x_org+180,y_org+45);
       tempDirty = false;
     } else {
       if(abs(feels_like) < 10) {
-        xoffset+=48;
+        xoffset+=VALUE_SCALE(48);
       } else if(abs(feels_like)> 99) {
-        xoffset-=32;
+        xoffset-=VALUE_SCALE(32);
       }
 
       if(feels_like < 0) 
-        xoffset-=32;
+        xoffset-=VALUE_SCALE(32);
       
-      tft->textSetCursor(x_org + xoffset, y_org + yoffset);
-
       char buffer[7];
       sprintf(buffer,"%3.1f", feels_like);
-      printString(buffer);
+      valueList.begin();
+      valueList.text(x_org + TEMP_VALUE_X, y_org + TEMP_VALUE_Y, TEMP_VALUE_WIDTH, TEMP_VALUE_HEIGTH, x_org + xoffset, y_org + yoffset, buffer);
+      valueList.end();
 
       //drawThermometer(x_org+180,y_org+45);
       tempDirty = false;
@@ -199,51 +184,51 @@ void TemperaturePanel::draw() {
     extremeDirty = false;
   }
 
-  
+  if(historyDirty) {
+    history.draw();
+    historyDirty = false;
+  }
 }
 
-void TemperaturePanel::drawExtremes() {
-  redrawBackgroundSection(x_org+1, y_org+TEMP_XTREME_YOFFSET, TEMP_WIDTH-1, 49);
+void TemperaturePanel::reportDamage() {
+  if(borderDirty && !indoor)
+    addDamage(x_org + PANEL_TITLE_INSET, y_org + PANEL_TITLE_Y, TEMP_WIDTH - 2*PANEL_TITLE_INSET, PANEL_TITLE_HEIGTH);
 
-  tft->textMode();
-  tft->textTransparent(RA8875_WHITE);
-  
-  tft->textEnlarge(0);
+  if(tempDirty)
+    addValueDamage(x_org + TEMP_VALUE_X, y_org + TEMP_VALUE_Y, TEMP_VALUE_WIDTH, TEMP_VALUE_HEIGTH);
 
-  tft->textSetCursor(x_org+25,y_org+TEMP_XTREME_YOFFSET);
-  printString("Low");
-  tft->textSetCursor(x_org+TEMP_WIDTH-27-32,y_org+TEMP_XTREME_YOFFSET);
-  printString("High");
+  if(extremeDirty)
+    addDamage(x_org+1, y_org+TEMP_XTREME_YOFFSET, TEMP_WIDTH-1, XTREME_HEIGTH);
+}
+
+void TemperaturePanel::drawExtremes() {
+  redrawBackgroundSection(x_org+1, y_org+TEMP_XTREME_YOFFSET, TEMP_WIDTH-1, XTREME_HEIGTH);
+
+  if(!chromeBaked())
+    drawChrome(x_org, y_org, tempChrome, CHROME_COUNT(tempChrome), CHROME_EXTREMES, indoor);
 
-  //Character Width = 8 Space =2
-  setSmallArialFont();
   switch(highlow) {
     case DAILY:
       getDailyExtremes();
-      tft->textSetCursor(x_org+(TEMP_WIDTH/2)-24,y_org+TEMP_XTREME_YOFFSET+15);
-      printString("Daily");
       break;
     case WEEKLY:
       getExtendedExtremes(7);
-      tft->textSetCursor(x_org+(TEMP_WIDTH/2)-29,y_org+TEMP_XTREME_YOFFSET+15);
-      printString("Weekly");
       break;
     case MONTHLY:
       getExtendedExtremes(30);
-      tft->textSetCursor(x_org+(TEMP_WIDTH/2)-34,y_org+TEMP_XTREME_YOFFSET+15);
-      printString("Monthly");
       break;
     case YEARLY:
       getExtendedExtremes(365);
-      tft->textSetCursor(x_org+(TEMP_WIDTH/2)-29,y_org+TEMP_XTREME_YOFFSET+15);
-      printString("Yearly");
       break;      
     default:
       break;
   }
+
+  const PeriodLabel *label = &xtremeLabels[highlow];
+  queueString(x_org+(TEMP_WIDTH/2)-label->half,y_org+TEMP_XTREME_YOFFSET+XTREME_VALUE_Y,FONT_SMALL_ARIAL,0,RA8875_WHITE,label->text);
   
-  drawCenteredArial((3*8)/2+25+x_org,y_org+TEMP_XTREME_YOFFSET+15,low);
-  drawCenteredArial(x_org+(TEMP_WIDTH -27 -(4*8)/2),y_org+TEMP_XTREME_YOFFSET+15,high);
+  drawCenteredArial(x_org+XTREME_LOW_CENTER,y_org+TEMP_XTREME_YOFFSET+XTREME_VALUE_Y,low);
+  drawCenteredArial(x_org+XTREME_HIGH_CENTER(TEMP_WIDTH),y_org+TEMP_XTREME_YOFFSET+XTREME_VALUE_Y,high);
 }
 
 void TemperaturePanel::getDailyExtremes() {
@@ -312,7 +297,7 @@ bool TemperaturePanel::isClicked(uint16_t x, uint16_t y) {
       }
     }
 
-    draw();
+    schedulePanel(this, true);
     return true;
   }
 
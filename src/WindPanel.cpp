@@ -44,43 +44,23 @@ WindPanel::WindPanel(Adafruit_RA8875 *_tft, uint16_t _x, uint16_t _y) {
 void WindPanel::draw() {
 
   if(borderDirty) {
-    tft->graphicsMode();
-    tft->drawLine(x_org,y_org, x_org,y_org+WIND_HEIGTH-25,RA8875_YELLOW); // Left
-    tft->drawLine(x_org+WIND_WIDTH,y_org, x_org+WIND_WIDTH,y_org+WIND_HEIGTH-25,RA8875_YELLOW); // Right
-    tft->drawLine(x_org+25,y_org+WIND_HEIGTH, x_org+WIND_WIDTH-25,y_org+WIND_HEIGTH,RA8875_YELLOW); //Bottom
-    tft->drawCurve(x_org+25, y_org+WIND_HEIGTH-25, 25, 25,0,RA8875_YELLOW);
-    tft->drawCurve(x_org+WIND_WIDTH-25, y_org+WIND_HEIGTH-25, 25, 25,3,RA8875_YELLOW);
-
-    tft->textMode();
-    tft->textTransparent(RA8875_WHITE);
-    tft->textEnlarge(0);
-    
-    redrawBackgroundSection(x_org + 14, y_org +3, WIND_WIDTH - 28, 20);
-    tft->textSetCursor(x_org+(WIND_WIDTH-40)/2, y_org+3);
+    waitDisplayIdle();
+    if(!chromeBaked())
+      drawChrome(x_org, y_org, windChrome, CHROME_COUNT(windChrome), CHROME_BORDER, false);
+
+    redrawBackgroundSection(x_org + PANEL_TITLE_INSET, y_org + PANEL_TITLE_Y, WIND_WIDTH - 2*PANEL_TITLE_INSET, PANEL_TITLE_HEIGTH);
 
     if(displayMode==WIND_MODE)
-      printString("Wind");
+      queueString(x_org+(WIND_WIDTH-40)/2, y_org+PANEL_TITLE_Y, FONT_INTERNAL, 0, RA8875_WHITE, "Wind");
     else if(displayMode==GUST_MODE)
-      printString("Gust");
-    else if(displayMode == MAXGUST_MODE) {
-      tft->textSetCursor(x_org+(WIND_WIDTH-40)/2 - 20, y_org+3);
-      printString("Max Gust");
-    }
+      queueString(x_org+(WIND_WIDTH-40)/2, y_org+PANEL_TITLE_Y, FONT_INTERNAL, 0, RA8875_WHITE, "Gust");
+    else if(displayMode == MAXGUST_MODE)
+      queueString(x_org+(WIND_WIDTH-40)/2 - 20, y_org+PANEL_TITLE_Y, FONT_INTERNAL, 0, RA8875_WHITE, "Max Gust");
 
     borderDirty = false;
   }
 
   if(windDirty) {
-    redrawBackgroundSection(x_org+ 25, y_org+30, WIND_WIDTH-30, WIND_HEIGTH - 42);
-    //tft->drawRect(x_org+ 25, y_org+30, WIND_WIDTH-30, WIND_HEIGTH - 42, RA8875_GREEN);
-
-    tft->textMode();
-    setArialFont();
-    tft->textEnlarge(1);
-    tft->textTransparent(RA8875_WHITE);
-    tft->textSetCursor(x_org+35,y_org+30);
-
-
     char buffer[4];
     float value;
     switch(displayMode) {
@@ -103,23 +83,31 @@ void WindPanel::draw() {
       sprintf(buffer,"%2.0f",value);
     } 
 
-    printString(buffer);
+    drawLargeValue(x_org+WIND_VALUE_X, y_org+WIND_VALUE_Y, WIND_VALUE_WIDTH, WIND_VALUE_HEIGTH, x_org+WIND_TEXT_X, y_org+WIND_TEXT_Y, buffer);
 
-    tft->textEnlarge(0);
-    tft->textSetCursor(x_org+160, y_org+50);
+    redrawValueBoxSection(x_org+WIND_DIR_X, y_org+WIND_DIR_Y, WIND_DIR_WIDTH, WIND_DIR_HEIGTH);
 
+    uint16_t x_dir = x_org+WIND_DIR_X;
     if(strlen(direction)==1)
-      tft->textSetCursor(x_org+192, y_org+50);
+      x_dir = x_org+WIND_DIR_X+2*WIND_DIR_STEP;
     
     if(strlen(direction) == 2)
-      tft->textSetCursor(x_org+176, y_org+50);
-    printString(direction);
+      x_dir = x_org+WIND_DIR_X+WIND_DIR_STEP;
+    queueString(x_dir, y_org+WIND_DIR_Y, FONT_ARIAL, 0, RA8875_WHITE, direction);
 
     windDirty = false;
   }
   
 }
 
+void WindPanel::reportDamage() {
+  if(borderDirty)
+    addDamage(x_org + PANEL_TITLE_INSET, y_org + PANEL_TITLE_Y, WIND_WIDTH - 2*PANEL_TITLE_INSET, PANEL_TITLE_HEIGTH);
+
+  if(windDirty)
+    addValueDamage(x_org+WIND_VALUE_X, y_org+WIND_VALUE_Y, WIND_VALUE_WIDTH, WIND_VALUE_HEIGTH);
+}
+
 bool WindPanel::isClicked(uint16_t x, uint16_t y) {
   if((x>(x_org+WIND_CLICK_MIN_X))&&(y>(y_org+WIND_CLICK_MIN_Y))&&(x<(x_org+WIND_CLICK_MAX_X))&&(y<(y_org+WIND_CLICK_MAX_Y))) {
     switch(displayMode) {
@@ -137,7 +125,7 @@ bool WindPanel::isClicked(uint16_t x, uint16_t y) {
     }
     borderDirty = true;
     windDirty = true;
-    draw();
+    schedulePanel(this, true);
     return true;
   }
 
@@ -0,0 +1,312 @@
+/**
+ *  @filename   :   assetpack.cpp
+ *  @brief      :   ESP32 Ecowitt Weather Station Console, asset pack partition module
+ *
+ *  @author     :   Kevin Kessler
+ *
+ * Copyright (C) 2024 Kevin Kessler
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <Arduino.h>
+#include "esp_partition.h"
+#include "esp_idf_version.h"
+#include "assetpack.h"
+#include "Layout.h"
+
+#define PACK_SECTOR_SIZE 4096
+
+#if ESP_IDF_VERSION_MAJOR >= 5
+typedef esp_partition_mmap_handle_t PackMapHandle;
+#define packUnmap(h) esp_partition_munmap(h)
+#else
+typedef spi_flash_mmap_handle_t PackMapHandle;
+#define packUnmap(h) spi_flash_munmap(h)
+#endif
+
+// RAM side of a pack entry, pointing into the mapped partition
+struct PackSlot {
+  Asset asset;
+  union {
+    RleImage rle;
+    MonoIcon mono;
+    SpanBitmap span;
+  };
+  MonoPlane planes[ASSET_PACK_MAX_PLANES];
+};
+
+static const esp_partition_t *packPartition = NULL;
+static const uint8_t *packBase = NULL;
+static PackMapHandle packHandle;
+static PackSlot packSlots[ASSET_PACK_MAX_ASSETS];
+static uint8_t packCount = 0;
+
+static bool packWriting = false;
+static uint32_t packWritten = 0;
+static AssetPackHeader pendingHeader;   // Written last, a partial upload never looks valid
+
+static const esp_partition_t *findPartition() {
+  if(packPartition == NULL)
+    packPartition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+      (esp_partition_subtype_t)ASSET_PACK_SUBTYPE, "assets");
+
+  return packPartition;
+}
+
+// Every row's packets have to stay inside the data and decode to exactly width pixels,
+// rleRead() trusts both
+static bool rleRowsValid(const RleImage *img, uint32_t dataLen) {
+  for(uint16_t n=0;n<img->height;n++) {
+    uint32_t pos = img->rowOffsets[n];
+    uint32_t pixels = 0;
+
+    while(pixels < img->width) {
+      if(pos >= dataLen)
+        return false;
+
+      uint8_t header = img->data[pos];
+      uint32_t count = (header & ~RLE_RUN) + 1;
+      pos += (header & RLE_RUN) ? 3 : 1 + count*2;
+      pixels += count;
+    }
+
+    if((pixels != img->width) || (pos > dataLen))
+      return false;
+  }
+
+  return true;
+}
+
+// Check the entry's data fits what its format needs and point a slot at it.  Nothing
+// bigger than the screen can be drawn, bounding the size first keeps the sums in 32 bits.
+static bool loadEntry(PackSlot *slot, const AssetPackEntry *e, uint32_t size) {
+  if((memchr(e->name, 0, ASSET_PACK_NAME_LEN) == NULL) || (e->offset & 3) || (e->offset > size) ||
+    (e->length > size - e->offset) || (e->width > SCREEN_WIDTH) || (e->height > SCREEN_HEIGHT))
+    return false;
+
+  const uint8_t *data = packBase + e->offset;
+  uint32_t pixels = (uint32_t)e->width * e->height;
+  uint32_t stride = (e->width + 7) / 8;
+
+  slot->asset.name = e->name;
+  slot->asset.format = e->format;
+  slot->asset.flags = e->flags;
+  slot->asset.width = e->width;
+  slot->asset.height = e->height;
+
+  switch(e->format) {
+    case ASSET_RAW:
+      if(e->length < pixels*2)
+        return false;
+      slot->asset.data = data;
+      return true;
+
+    case ASSET_RLE: {
+      uint32_t table = (uint32_t)e->height*4;
+      if(e->length < table)
+        return false;
+      const uint32_t *rows = (const uint32_t *)data;
+      for(uint16_t n=0;n<e->height;n++)
+        if(rows[n] >= e->length - table)
+          return false;
+
+      slot->rle.width = e->width;
+      slot->rle.height = e->height;
+      slot->rle.rowOffsets = rows;
+      slot->rle.data = data + table;
+      if(!rleRowsValid(&slot->rle, e->length - table))
+        return false;
+      slot->asset.data = &slot->rle;
+      return true;
+    }
+
+    case ASSET_MONO: {
+      uint32_t colors = (e->count*2 + 3) & ~3;
+      if((e->count == 0) || (e->count > ASSET_PACK_MAX_PLANES) || (e->length < colors + e->count*stride*e->height))
+        return false;
+
+      for(uint8_t n=0;n<e->count;n++) {
+        slot->planes[n].color = ((const uint16_t *)data)[n];
+        slot->planes[n].bits = data + colors + n*stride*e->height;
+      }
+      slot->mono.width = e->width;
+      slot->mono.height = e->height;
+      slot->mono.planes = e->count;
+      slot->mono.plane = slot->planes;
+      slot->asset.data = &slot->mono;
+      return true;
+    }
+
+    case ASSET_SPAN: {
+      uint32_t table = (uint32_t)e->count*sizeof(SpanRun);
+      if(e->length < table)
+        return false;
+      const SpanRun *runs = (const SpanRun *)data;
+      uint64_t spanPixels = (e->count == 0) ? pixels : 0;   // Runs may overlap, doubled the sum can pass 32 bits
+      for(uint16_t n=0;n<e->count;n++) {
+        if((runs[n].x + runs[n].w > e->width) || (runs[n].y + runs[n].h > e->height))
+          return false;
+        spanPixels += (uint32_t)runs[n].w * runs[n].h;
+      }
+      if(e->length - table < spanPixels*2)
+        return false;
+
+      slot->span.width = e->width;
+      slot->span.height = e->height;
+      slot->span.runCount = e->count;
+      slot->span.runs = (e->count == 0) ? NULL : runs;
+      slot->span.pixels = data + table;
+      slot->asset.data = &slot->span;
+      return true;
+    }
+
+    default:
+      return false;
+  }
+}
+
+// Map the pack and index it, anything not in it stays the compiled in asset
+bool assetPackBegin() {
+  const esp_partition_t *part = findPartition();
+  AssetPackHeader header;
+
+  assetPackEnd();
+
+  if(part == NULL) {
+    Serial.println("No assets partition");
+    return false;
+  }
+
+  if((esp_partition_read(part, 0, &header, sizeof(header)) != ESP_OK) || (header.magic != ASSET_PACK_MAGIC) ||
+    (header.version != ASSET_PACK_VERSION) || (header.size > part->size) ||
+    (header.size < sizeof(header) + header.count*sizeof(AssetPackEntry))) {
+    Serial.println("No asset pack, using built in assets");
+    return false;
+  }
+
+  const void *base;
+  if(esp_partition_mmap(part, 0, header.size, ESP_PARTITION_MMAP_DATA, &base, &packHandle) != ESP_OK) {
+    Serial.println("Asset pack mmap failed");
+    return false;
+  }
+  packBase = (const uint8_t *)base;
+
+  const AssetPackEntry *entries = (const AssetPackEntry *)(packBase + sizeof(header));
+  for(uint16_t n=0;(n<header.count) && (packCount<ASSET_PACK_MAX_ASSETS);n++) {
+    if(loadEntry(&packSlots[packCount], &entries[n], header.size))
+      packCount++;
+    else
+      Serial.printf("Asset pack entry %u is bad, skipped\n", n);
+  }
+
+  Serial.printf("Asset pack: %u assets, %lu bytes mapped\n", packCount, (unsigned long)header.size);
+  return true;
+}
+
+// Nothing may draw from the pack once this returns
+void assetPackEnd() {
+  if(packBase == NULL)
+    return;
+
+  packCount = 0;
+  packBase = NULL;
+  packUnmap(packHandle);
+}
+
+const Asset *assetPackFind(const char *name) {
+  for(uint8_t n=0;n<packCount;n++)
+    if(strcmp(packSlots[n].asset.name, name) == 0)
+      return &packSlots[n].asset;
+
+  return NULL;
+}
+
+const Asset *assetPackResolve(const Asset *builtin) {
+  if(packCount == 0)
+    return builtin;
+
+  // The layout is built around the compiled in size, a pack asset of another size is ignored
+  const Asset *a = assetPackFind(builtin->name);
+  if((a == NULL) || (a->width != builtin->width) || (a->height != builtin->height))
+    return builtin;
+
+  return a;
+}
+
+// Unmaps the current pack, the caller has to stop drawing from it first
+bool assetPackWriteBegin() {
+  assetPackEnd();
+
+  packWritten = 0;
+  packWriting = (findPartition() != NULL);
+  return packWriting;
+}
+
+// Sectors are erased as the upload reaches them, a small pack doesn't wait on the whole
+// partition.  The header is held back until assetPackWriteEnd() has seen the lot.
+bool assetPackWrite(const uint8_t *data, size_t len) {
+  const esp_partition_t *part = findPartition();
+
+  if(!packWriting)
+    return false;
+
+  if(len > part->size - packWritten) {
+    Serial.println("Asset pack larger than the assets partition");
+    packWriting = false;
+    return false;
+  }
+
+  uint32_t erased = (packWritten + PACK_SECTOR_SIZE - 1) & ~(PACK_SECTOR_SIZE - 1);
+  uint32_t end = packWritten + len;
+  if(end > erased) {
+    uint32_t eraseLen = (end - erased + PACK_SECTOR_SIZE - 1) & ~(PACK_SECTOR_SIZE - 1);
+    if(esp_partition_erase_range(part, erased, eraseLen) != ESP_OK) {
+      packWriting = false;
+      return false;
+    }
+  }
+
+  while((len > 0) && (packWritten < sizeof(pendingHeader))) {
+    ((uint8_t *)&pendingHeader)[packWritten++] = *data++;
+    len--;
+  }
+
+  if((len > 0) && (esp_partition_write(part, packWritten, data, len) != ESP_OK)) {
+    packWriting = false;
+    return false;
+  }
+  packWritten += len;
+
+  return true;
+}
+
+bool assetPackWriteEnd() {
+  if(!packWriting)
+    return false;
+  packWriting = false;
+
+  if((packWritten < sizeof(pendingHeader)) || (pendingHeader.magic != ASSET_PACK_MAGIC) ||
+    (pendingHeader.version != ASSET_PACK_VERSION) || (pendingHeader.size > packWritten)) {
+    Serial.println("Asset pack upload is not a valid pack");
+    return false;
+  }
+
+  if(esp_partition_write(findPartition(), 0, &pendingHeader, sizeof(pendingHeader)) != ESP_OK)
+    return false;
+
+  Serial.printf("Asset pack written, %lu bytes\n", (unsigned long)packWritten);
+  return true;
+}
@@ -1,259 +1,286 @@
-/**
- *  @filename   :   bitmaps.cpp
- *  @brief      :   ESP32 Ecowitt Weather Station Console bitmaps module
- *
- *  @author     :   Kevin Kessler
- *
- * Copyright (C) 2024 Kevin Kessler
- *
- *    This program is free software: you can redistribute it and/or modify
- *    it under the terms of the GNU General Public License as published by
- *    the Free Software Foundation, either version 3 of the License, or
- *    (at your option) any later version.
- *
- *    This program is distributed in the hope that it will be useful,
- *    but WITHOUT ANY WARRANTY; without even the implied warranty of
- *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
- *    GNU General Public License for more details.
- *
- *    You should have received a copy of the GNU General Public License
- *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
- *
- */
+// Generated by tools/assetgen.cpp from assets/assets.txt, do not edit
 #include <Arduino.h>
-#include "display.h"
+#include "bitmaps.h"
 
-const uint8_t up_arrow [] = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 
-  0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 
-  0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 
-  0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 
-  0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 
-  0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 
-  0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xa0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0x05, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+static const uint8_t up_arrow_mono_p0[] = {
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3e, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xc0, 0x00, 0x00, 0x00, 0x00, 0xfb, 0xe0, 0x00, 0x00, 0x00, 0x01, 0xf7, 0xb0,
+  0x00, 0x00, 0x00, 0x03, 0xef, 0x78, 0x00, 0x00, 0x00, 0x07, 0xde, 0xf4, 0x00, 0x00, 0x00, 0x0f, 0xbd, 0xee, 0x00, 0x00,
+  0x00, 0x1f, 0x7b, 0xdf, 0x00, 0x00, 0x00, 0x3e, 0xf7, 0xbd, 0x80, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xc0, 0x00, 0x00, 0xfb,
+  0xde, 0xf7, 0xa0, 0x00, 0x01, 0xf7, 0xbd, 0xef, 0x70, 0x00, 0x03, 0xef, 0x7b, 0xde, 0xf8, 0x00, 0x07, 0xde, 0xf7, 0xfd,
+  0xec, 0x00, 0x0f, 0xbd, 0xef, 0x7b, 0xde, 0x00, 0x1f, 0x7b, 0x5e, 0xd7, 0xbd, 0x00, 0x3e, 0xf6, 0x7d, 0xcf, 0x7b, 0x80,
+  0x7d, 0xec, 0x7b, 0xc6, 0xf7, 0xc0, 0xfb, 0xd8, 0x77, 0xc3, 0xef, 0x60, 0xf7, 0xb0, 0x6f, 0x41, 0xde, 0xe0, 0xef, 0x60,
+  0x7e, 0xc0, 0xbd, 0xe0, 0xde, 0xc0, 0x7d, 0xc0, 0x7b, 0xe0, 0xfd, 0x80, 0x7b, 0xc0, 0x37, 0xe0, 0x7b, 0x00, 0x77, 0xc0,
+  0x1f, 0xc0, 0x3e, 0x00, 0x6f, 0x40, 0x0f, 0x80, 0x00, 0x00, 0x5e, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x7b, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x77, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  0x5e, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x77, 0xc0,
+  0x00, 0x00, 0x00, 0x00, 0x6f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x5e, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x7b, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x77, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x6f, 0x40, 0x00, 0x00, 0x00, 0x00,
+  0x7e, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7d, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7b, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x77, 0xc0,
+  0x00, 0x00, 0x00, 0x00, 0x6f, 0x40, 0x00, 0x00, 0x00, 0x00, 0x3e, 0x80, 0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00
 };
 
-const uint8_t down_arrow[] ={
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 
-  0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 
-  0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 
-  0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 
-  0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 
-  0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 
-  0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xf8, 0x01, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x01, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+static const uint8_t up_arrow_mono_p1[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x40,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x80, 0x00, 0x00, 0x00, 0x00, 0x21, 0x08, 0x00, 0x00, 0x00, 0x00, 0x42, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x84, 0x20, 0x00, 0x00, 0x00, 0x01, 0x08, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0x21, 0x08, 0x40, 0x00, 0x00, 0x08, 0x42, 0x10, 0x80, 0x00, 0x00, 0x10, 0x84, 0x21, 0x00, 0x00, 0x00, 0x21, 0x08, 0x02,
+  0x10, 0x00, 0x00, 0x42, 0x10, 0x84, 0x20, 0x00, 0x00, 0x84, 0x21, 0x08, 0x42, 0x00, 0x01, 0x08, 0x02, 0x00, 0x84, 0x00,
+  0x02, 0x10, 0x04, 0x01, 0x08, 0x00, 0x04, 0x20, 0x08, 0x00, 0x10, 0x80, 0x08, 0x40, 0x10, 0x80, 0x21, 0x00, 0x10, 0x80,
+  0x01, 0x00, 0x42, 0x00, 0x21, 0x00, 0x02, 0x00, 0x04, 0x00, 0x02, 0x00, 0x04, 0x00, 0x08, 0x00, 0x04, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x80, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x21, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x10, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
-const uint8_t steady[] = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0xff, 0xff, 
-  0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 
-  0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 
-  0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 
-  0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 
-  0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 
-  0xff, 0xff, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0x3f, 0x1f, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+
+static const MonoPlane up_arrow_mono_planes[] = {
+  {0x05c0, up_arrow_mono_p0},
+  {0x05a0, up_arrow_mono_p1},
+};
+
+const MonoIcon up_arrow_mono = {43, 50, 2, up_arrow_mono_planes};
+
+const Asset up_arrow_asset = {"up_arrow", ASSET_MONO, 0, 43, 50, &up_arrow_mono};
+
+static const uint8_t down_arrow_mono_p0[] = {
+  0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc0,
+  0x00, 0x00, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc0,
+  0x00, 0x00, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00,
+  0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x3e, 0x00, 0x7f, 0xc0, 0x0f, 0x80, 0x7f, 0x00,
+  0x7f, 0xc0, 0x1f, 0xc0, 0xff, 0x80, 0x7f, 0xc0, 0x3f, 0xe0, 0xff, 0xc0, 0x7f, 0xc0, 0x7f, 0xe0, 0xff, 0xe0, 0x7f, 0xc0,
+  0xff, 0xe0, 0xff, 0xf0, 0x7f, 0xc1, 0xff, 0xe0, 0xff, 0xf8, 0x7f, 0xc3, 0xff, 0xe0, 0x7f, 0xfc, 0x7f, 0xc7, 0xff, 0xc0,
+  0x3f, 0xfe, 0x7f, 0xcf, 0xff, 0x80, 0x1f, 0xff, 0x7f, 0xdf, 0xff, 0x00, 0x0f, 0xff, 0xff, 0xff, 0xfe, 0x00, 0x07, 0xff,
+  0xff, 0xff, 0xfc, 0x00, 0x03, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x01, 0xff, 0xff, 0xff, 0xf0, 0x00, 0x00, 0xff, 0xff, 0xff,
+  0xe0, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x3f, 0xff, 0xff, 0x80, 0x00, 0x00, 0x1f, 0xff, 0xff, 0x00, 0x00,
+  0x00, 0x0f, 0xff, 0xfe, 0x00, 0x00, 0x00, 0x07, 0xff, 0xfc, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x01,
+  0xff, 0xf0, 0x00, 0x00, 0x00, 0x00, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x3f, 0x80,
+  0x00, 0x00, 0x00, 0x00, 0x1f, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0e, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00
+};
+
+static const MonoPlane down_arrow_mono_planes[] = {
+  {0xf801, down_arrow_mono_p0},
+};
+
+const MonoIcon down_arrow_mono = {43, 50, 1, down_arrow_mono_planes};
+
+const Asset down_arrow_asset = {"down_arrow", ASSET_MONO, 0, 43, 50, &down_arrow_mono};
+
+static const uint8_t steady_mono_p0[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x3f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff, 0xff, 0xe0, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xe0, 0x7f, 0xff, 0xff, 0xff, 0xff, 0xc0, 0x3f, 0xff, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
 };
-const uint8_t rain[] = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x59, 0x4c, 0x79, 0x54, 0x99, 0x54, 0x99, 0x54, 0x79, 0x4c, 0x59, 0x54, 0x79, 0x54, 0x99, 0x54, 0x99, 0x54, 0x79, 0x4c, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x39, 0x4c, 0x39, 0x54, 0x79, 0x54, 0x99, 0x95, 0xdc, 0xbe, 0xde, 0xbe, 0xde, 0xd7, 0x3f, 0xdf, 0x7f, 0xd7, 0x5f, 0xbe, 0xde, 0xbe, 0xde, 0x95, 0xfc, 0x54, 0x99, 0x54, 0x99, 0x4c, 0x59, 0x4c, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x39, 0x4c, 0x39, 0x54, 0x79, 0x54, 0x99, 0x95, 0xdc, 0xbe, 0xde, 0xbe, 0xde, 0xd7, 0x3f, 0xdf, 0x7f, 0xd7, 0x5f, 0xbe, 0xde, 0xbe, 0xde, 0x95, 0xfc, 0x54, 0x99, 0x54, 0x99, 0x4c, 0x59, 0x4c, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x59, 0x54, 0x79, 0x54, 0x79, 0x9e, 0x1d, 0xdf, 0x7f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xdf, 0x7f, 0x9e, 0x1d, 0x54, 0x79, 0x54, 0x79, 0x4c, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x59, 0x54, 0x99, 0xc6, 0xde, 0xc6, 0xde, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xc6, 0xfe, 0xc6, 0xfe, 0x54, 0x99, 0x4c, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x39, 0x54, 0x79, 0xc6, 0xde, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xc6, 0xfe, 0x54, 0x79, 0x44, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0x79, 0x9e, 0x1d, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0x9e, 0x1d, 0x54, 0x99, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0x79, 0x9e, 0x1d, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0x9e, 0x1d, 0x54, 0x99, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x59, 0x4c, 0x59, 0x54, 0x99, 0xdf, 0x7f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xdf, 0x7f, 0x54, 0x99, 0x4c, 0x59, 0x4c, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x79, 0x4c, 0x79, 0x95, 0xdc, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0x95, 0xdc, 0x4c, 0x79, 0x4c, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0x99, 0x54, 0x99, 0xbe, 0xde, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xc6, 0xde, 0x4c, 0x79, 0x4c, 0x79, 0x4c, 0x59, 0x4c, 0x59, 0x54, 0x99, 0x4c, 0x59, 0x4c, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0x79, 0x54, 0x79, 0xd7, 0x3f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xdf, 0x7f, 0xc6, 0xde, 0xc6, 0xde, 0xdf, 0x7f, 0xdf, 0x7f, 0xbe, 0xde, 0x75, 0x3b, 0x75, 0x3b, 0x54, 0x79, 0x4c, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0x79, 0x54, 0x79, 0xd7, 0x3f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xdf, 0x7f, 0xc6, 0xde, 0xc6, 0xde, 0xdf, 0x7f, 0xdf, 0x7f, 0xbe, 0xde, 0x75, 0x3b, 0x75, 0x3b, 0x54, 0x79, 0x4c, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x59, 0x4c, 0x59, 0xdf, 0x7f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0x9e, 0x1c, 0x54, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x59, 0x54, 0x79, 0x4c, 0x59, 0x4c, 0x59, 0xdf, 0x5f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0x75, 0x3b, 0x4c, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0x79, 0x54, 0x99, 0x95, 0xfc, 0xce, 0xfe, 0xce, 0xfe, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xbe, 0xbe, 0x54, 0x99, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x54, 0x99, 0x54, 0x99, 0x7d, 0x5b, 0xdf, 0x5f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xdf, 0x7f, 0x4c, 0x59, 0x54, 0x99, 0x54, 0x99, 0x4c, 0x59, 0x4c, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x54, 0x99, 0x54, 0x99, 0x7d, 0x5b, 0xdf, 0x5f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xdf, 0x7f, 0x4c, 0x59, 0x54, 0x99, 0x54, 0x99, 0x4c, 0x59, 0x4c, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0x54, 0x79, 0x7d, 0x5b, 0x7d, 0x5b, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xdf, 0x7f, 0xc6, 0xde, 0xc6, 0xde, 0x8d, 0x9c, 0x54, 0x79, 0x4c, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0x4c, 0x79, 0x54, 0x99, 0xdf, 0x5f, 0xdf, 0x5f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xc6, 0xfe, 0x54, 0x99, 0x4c, 0x59, 0x4c, 0x59, 0xff, 0xff, 
-  0x54, 0x79, 0x9d, 0xfc, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xc6, 0xfe, 0x54, 0x79, 0x54, 0x79, 0x4c, 0x79, 
-  0x54, 0x99, 0xce, 0xfe, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0x85, 0x9c, 0x85, 0x9c, 0x4c, 0x59, 
-  0x54, 0x99, 0xce, 0xfe, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0x85, 0x9c, 0x85, 0x9c, 0x4c, 0x59, 
-  0x4c, 0x59, 0xdf, 0x7f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xc6, 0xde, 0xc6, 0xde, 0x54, 0x99, 
-  0x4c, 0x79, 0xdf, 0x7f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xdf, 0x7f, 0xdf, 0x7f, 0x4c, 0x79, 
-  0x54, 0x99, 0xc6, 0xfe, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xdf, 0x7f, 0xdf, 0x7f, 0x4c, 0x79, 
-  0x54, 0x79, 0x95, 0xfc, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xc6, 0xde, 0xc6, 0xde, 0x54, 0x99, 
-  0x54, 0x79, 0x95, 0xfc, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xc6, 0xde, 0xc6, 0xde, 0x54, 0x99, 
-  0x4c, 0x39, 0x54, 0x79, 0xdf, 0x5f, 0xdf, 0x5f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0x85, 0x9b, 0x85, 0x9b, 0x54, 0x79, 
-  0xff, 0xff, 0x54, 0x79, 0x75, 0x5b, 0x75, 0x5b, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0x8d, 0xbc, 0xd7, 0x3f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xc6, 0xfe, 0x54, 0x79, 0x54, 0x79, 0x54, 0x79, 
-  0xff, 0xff, 0xff, 0xff, 0x54, 0x79, 0x54, 0x79, 0x75, 0x5b, 0xdf, 0x5f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0x85, 0x7b, 0x85, 0x7b, 0x4c, 0x59, 0xae, 0x7d, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xc6, 0xfe, 0x54, 0x99, 0x4c, 0x59, 0x4c, 0x59, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0x79, 0x54, 0x79, 0x95, 0xfc, 0xc6, 0xfe, 0xc6, 0xfe, 0xdf, 0x7f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0x95, 0xfc, 0x5c, 0xda, 0x5c, 0xda, 0x75, 0x5c, 0x8d, 0xdc, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xdf, 0x7f, 0xc6, 0xde, 0xc6, 0xde, 0x85, 0x9b, 0x4c, 0x79, 0x4c, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0x79, 0x54, 0x79, 0x95, 0xfc, 0xc6, 0xfe, 0xc6, 0xfe, 0xdf, 0x7f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0x95, 0xfc, 0x5c, 0xda, 0x5c, 0xda, 0x75, 0x5c, 0x8d, 0xdc, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xdf, 0x7f, 0xc6, 0xde, 0xc6, 0xde, 0x85, 0x9b, 0x4c, 0x79, 0x4c, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x59, 0x54, 0x79, 0x54, 0x99, 0x54, 0x99, 0x4c, 0x79, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x54, 0x79, 0x96, 0x3f, 0x96, 0x3f, 0x85, 0xde, 0x4c, 0x79, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x79, 0x54, 0x99, 0x54, 0x99, 0x54, 0x79, 0x54, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0x79, 0x85, 0xbd, 0x9e, 0x7f, 0x9e, 0x7f, 0x96, 0x3f, 0x4c, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x59, 0x96, 0x5f, 0x9e, 0x7f, 0x9e, 0x7f, 0x96, 0x5f, 0x4c, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0x79, 0x75, 0x7c, 0x96, 0x5f, 0x96, 0x5f, 0x75, 0x7c, 0x54, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0x79, 0x75, 0x7c, 0x96, 0x5f, 0x96, 0x5f, 0x75, 0x7c, 0x54, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x79, 0x54, 0x79, 0x4c, 0x59, 0x4c, 0x59, 0x54, 0x79, 0x44, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0x79, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0x79, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x79, 0x5c, 0xba, 0x75, 0x5c, 0x75, 0x5c, 0x4c, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x79, 0x5c, 0xba, 0x75, 0x5c, 0x75, 0x5c, 0x4c, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x59, 0x54, 0x79, 0x96, 0x3f, 0x85, 0xde, 0x85, 0xde, 0x54, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x59, 0x54, 0x79, 0x96, 0x3f, 0x85, 0xde, 0x85, 0xde, 0x54, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x59, 0x54, 0x79, 0x96, 0x3f, 0x85, 0xde, 0x85, 0xde, 0x54, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x59, 0x54, 0x79, 0x96, 0x3f, 0x85, 0xde, 0x85, 0xde, 0x54, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0x79, 0x85, 0xbd, 0x9e, 0x7f, 0x96, 0x3f, 0x96, 0x3f, 0x4c, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0x79, 0x85, 0xbd, 0x9e, 0x7f, 0x96, 0x3f, 0x96, 0x3f, 0x4c, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x59, 0x96, 0x5f, 0x9e, 0x7f, 0x96, 0x5f, 0x96, 0x5f, 0x4c, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x59, 0x96, 0x5f, 0x9e, 0x7f, 0x96, 0x5f, 0x96, 0x5f, 0x4c, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0x79, 0x75, 0x7c, 0x96, 0x5f, 0x75, 0x7c, 0x75, 0x7c, 0x54, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0x79, 0x75, 0x7c, 0x96, 0x5f, 0x75, 0x7c, 0x75, 0x7c, 0x54, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x79, 0x54, 0x79, 0x4c, 0x59, 0x54, 0x79, 0x54, 0x79, 0x44, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x79, 0x54, 0x79, 0x4c, 0x59, 0x54, 0x79, 0x54, 0x79, 0x44, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x79, 0x54, 0x79, 0x4c, 0x59, 0x54, 0x79, 0x54, 0x79, 0x44, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x79, 0x54, 0x79, 0x4c, 0x59, 0x54, 0x79, 0x54, 0x79, 0x44, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+
+static const MonoPlane steady_mono_planes[] = {
+  {0x3f1f, steady_mono_p0},
 };
 
-const uint8_t battery[] = {
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
-  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 
+const MonoIcon steady_mono = {43, 50, 1, steady_mono_planes};
+
+const Asset steady_asset = {"steady", ASSET_MONO, 0, 43, 50, &steady_mono};
+
+static const uint8_t battery_mono_p0[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xc0, 0x3c, 0x00, 0x00, 0xc0,
+  0x3c, 0x00, 0x00, 0xc0, 0x30, 0x00, 0x00, 0xc0, 0x30, 0x00, 0x00, 0xc0, 0x30, 0x00, 0x00, 0xc0, 0x30, 0x00, 0x00, 0xc0,
+  0x30, 0x00, 0x00, 0xc0, 0x30, 0x00, 0x00, 0xc0, 0x30, 0x00, 0x00, 0xc0, 0x30, 0x00, 0x00, 0xc0, 0x3c, 0x00, 0x00, 0xc0,
+  0x3c, 0x00, 0x00, 0xc0, 0x0f, 0xff, 0xff, 0xc0, 0x0f, 0xff, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
 
+static const MonoPlane battery_mono_planes[] = {
+  {0x0000, battery_mono_p0},
 };
 
+const MonoIcon battery_mono = {28, 20, 1, battery_mono_planes};
+
+const Asset battery_asset = {"battery", ASSET_MONO, 0, 28, 20, &battery_mono};
+
+static const SpanRun rain_span_runs[] = {
+  {9, 1, 23, 8},
+  {7, 9, 34, 6},
+  {1, 15, 46, 5},
+  {0, 20, 50, 15},
+  {20, 35, 6, 4},
+  {12, 39, 23, 1},
+  {9, 40, 6, 9},
+  {29, 40, 6, 9},
+};
+
+static const uint8_t rain_span_pixels[] = {
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x59, 0x4c, 0x79, 0x54, 0x99, 0x54, 0x99,
+  0x54, 0x79, 0x4c, 0x59, 0x54, 0x79, 0x54, 0x99, 0x54, 0x99, 0x54, 0x79, 0x4c, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x39, 0x4c, 0x39, 0x54, 0x79, 0x54, 0x99,
+  0x95, 0xdc, 0xbe, 0xde, 0xbe, 0xde, 0xd7, 0x3f, 0xdf, 0x7f, 0xd7, 0x5f, 0xbe, 0xde, 0xbe, 0xde, 0x95, 0xfc, 0x54, 0x99,
+  0x54, 0x99, 0x4c, 0x59, 0x4c, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x39,
+  0x4c, 0x39, 0x54, 0x79, 0x54, 0x99, 0x95, 0xdc, 0xbe, 0xde, 0xbe, 0xde, 0xd7, 0x3f, 0xdf, 0x7f, 0xd7, 0x5f, 0xbe, 0xde,
+  0xbe, 0xde, 0x95, 0xfc, 0x54, 0x99, 0x54, 0x99, 0x4c, 0x59, 0x4c, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x4c, 0x59, 0x54, 0x79, 0x54, 0x79, 0x9e, 0x1d, 0xdf, 0x7f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xdf, 0x7f, 0x9e, 0x1d, 0x54, 0x79, 0x54, 0x79, 0x4c, 0x59,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x59, 0x54, 0x99, 0xc6, 0xde, 0xc6, 0xde, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xc6, 0xfe, 0xc6, 0xfe, 0x54, 0x99, 0x4c, 0x79, 0xff, 0xff, 0x4c, 0x39, 0x54, 0x79, 0xc6, 0xde, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xc6, 0xfe, 0x54, 0x79, 0x44, 0x59, 0x54, 0x79, 0x9e, 0x1d,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0x9e, 0x1d,
+  0x54, 0x99, 0x54, 0x79, 0x9e, 0x1d, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0x9e, 0x1d, 0x54, 0x99, 0x4c, 0x59, 0x4c, 0x59, 0x54, 0x99, 0xdf, 0x7f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xdf, 0x7f, 0x54, 0x99, 0x4c, 0x59,
+  0x4c, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x79, 0x4c, 0x79,
+  0x95, 0xdc, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0x95, 0xdc, 0x4c, 0x79, 0x4c, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x54, 0x99, 0x54, 0x99, 0xbe, 0xde, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xc6, 0xde, 0x4c, 0x79, 0x4c, 0x79, 0x4c, 0x59,
+  0x4c, 0x59, 0x54, 0x99, 0x4c, 0x59, 0x4c, 0x59, 0xff, 0xff, 0xff, 0xff, 0x54, 0x79, 0x54, 0x79, 0xd7, 0x3f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xdf, 0x7f, 0xc6, 0xde, 0xc6, 0xde, 0xdf, 0x7f, 0xdf, 0x7f, 0xbe, 0xde, 0x75, 0x3b, 0x75, 0x3b, 0x54, 0x79, 0x4c, 0x58,
+  0x54, 0x79, 0x54, 0x79, 0xd7, 0x3f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xdf, 0x7f, 0xc6, 0xde, 0xc6, 0xde, 0xdf, 0x7f, 0xdf, 0x7f, 0xbe, 0xde,
+  0x75, 0x3b, 0x75, 0x3b, 0x54, 0x79, 0x4c, 0x58, 0x4c, 0x59, 0x4c, 0x59, 0xdf, 0x7f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0x9e, 0x1c, 0x54, 0x79, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x4c, 0x59, 0x54, 0x79, 0x4c, 0x59, 0x4c, 0x59, 0xdf, 0x5f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0x75, 0x3b, 0x4c, 0x59, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0x79, 0x54, 0x99, 0x95, 0xfc,
+  0xce, 0xfe, 0xce, 0xfe, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xbe, 0xbe, 0x54, 0x99, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0x54, 0x99, 0x54, 0x99, 0x7d, 0x5b, 0xdf, 0x5f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xdf, 0x7f,
+  0x4c, 0x59, 0x54, 0x99, 0x54, 0x99, 0x4c, 0x59, 0x4c, 0x59, 0xff, 0xff, 0xff, 0xff, 0x54, 0x99, 0x54, 0x99, 0x7d, 0x5b,
+  0xdf, 0x5f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xdf, 0x7f, 0x4c, 0x59, 0x54, 0x99, 0x54, 0x99, 0x4c, 0x59,
+  0x4c, 0x59, 0xff, 0xff, 0x54, 0x79, 0x7d, 0x5b, 0x7d, 0x5b, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xdf, 0x7f, 0xc6, 0xde, 0xc6, 0xde, 0x8d, 0x9c, 0x54, 0x79, 0x4c, 0x59, 0x4c, 0x79, 0x54, 0x99,
+  0xdf, 0x5f, 0xdf, 0x5f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xc6, 0xfe, 0x54, 0x99, 0x4c, 0x59, 0x4c, 0x59, 0xff, 0xff, 0x54, 0x79, 0x9d, 0xfc,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xc6, 0xfe, 0x54, 0x79, 0x54, 0x79, 0x4c, 0x79, 0x54, 0x99, 0xce, 0xfe,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0x85, 0x9c, 0x85, 0x9c, 0x4c, 0x59, 0x54, 0x99, 0xce, 0xfe,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0x85, 0x9c, 0x85, 0x9c, 0x4c, 0x59, 0x4c, 0x59, 0xdf, 0x7f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xc6, 0xde, 0xc6, 0xde, 0x54, 0x99, 0x4c, 0x79, 0xdf, 0x7f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xdf, 0x7f, 0xdf, 0x7f, 0x4c, 0x79, 0x54, 0x99, 0xc6, 0xfe,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xdf, 0x7f, 0xdf, 0x7f, 0x4c, 0x79, 0x54, 0x79, 0x95, 0xfc,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xc6, 0xde, 0xc6, 0xde, 0x54, 0x99, 0x54, 0x79, 0x95, 0xfc,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xc6, 0xde, 0xc6, 0xde, 0x54, 0x99, 0x4c, 0x39, 0x54, 0x79,
+  0xdf, 0x5f, 0xdf, 0x5f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0x85, 0x9b, 0x85, 0x9b, 0x54, 0x79, 0xff, 0xff, 0x54, 0x79,
+  0x75, 0x5b, 0x75, 0x5b, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0x8d, 0xbc, 0xd7, 0x3f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xc6, 0xfe, 0x54, 0x79, 0x54, 0x79, 0x54, 0x79, 0xff, 0xff, 0xff, 0xff,
+  0x54, 0x79, 0x54, 0x79, 0x75, 0x5b, 0xdf, 0x5f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0x85, 0x7b, 0x85, 0x7b, 0x4c, 0x59, 0xae, 0x7d, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xc6, 0xfe, 0x54, 0x99, 0x4c, 0x59, 0x4c, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x54, 0x79, 0x54, 0x79, 0x95, 0xfc, 0xc6, 0xfe, 0xc6, 0xfe, 0xdf, 0x7f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0x95, 0xfc,
+  0x5c, 0xda, 0x5c, 0xda, 0x75, 0x5c, 0x8d, 0xdc, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xdf, 0x7f,
+  0xc6, 0xde, 0xc6, 0xde, 0x85, 0x9b, 0x4c, 0x79, 0x4c, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x54, 0x79, 0x54, 0x79, 0x95, 0xfc, 0xc6, 0xfe, 0xc6, 0xfe, 0xdf, 0x7f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0x95, 0xfc,
+  0x5c, 0xda, 0x5c, 0xda, 0x75, 0x5c, 0x8d, 0xdc, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f,
+  0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xe7, 0x9f, 0xdf, 0x7f,
+  0xc6, 0xde, 0xc6, 0xde, 0x85, 0x9b, 0x4c, 0x79, 0x4c, 0x59, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x4c, 0x59, 0x54, 0x79, 0x54, 0x99, 0x54, 0x99, 0x4c, 0x79, 0x4c, 0x59, 0x4c, 0x59,
+  0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x54, 0x79,
+  0x96, 0x3f, 0x96, 0x3f, 0x85, 0xde, 0x4c, 0x79, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59,
+  0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x79,
+  0x54, 0x99, 0x54, 0x99, 0x54, 0x79, 0x54, 0x79, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x54, 0x79, 0x85, 0xbd,
+  0x9e, 0x7f, 0x9e, 0x7f, 0x96, 0x3f, 0x4c, 0x79, 0x4c, 0x59, 0x96, 0x5f, 0x9e, 0x7f, 0x9e, 0x7f, 0x96, 0x5f, 0x4c, 0x59,
+  0x54, 0x79, 0x75, 0x7c, 0x96, 0x5f, 0x96, 0x5f, 0x75, 0x7c, 0x54, 0x79, 0x54, 0x79, 0x75, 0x7c, 0x96, 0x5f, 0x96, 0x5f,
+  0x75, 0x7c, 0x54, 0x79, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x39, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0x4c, 0x79, 0x54, 0x79, 0x4c, 0x59, 0x4c, 0x59, 0x54, 0x79, 0x44, 0x58, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xff, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x39, 0xff, 0xff, 0xff, 0xff, 0x54, 0x79, 0x4c, 0x59, 0x4c, 0x59,
+  0x4c, 0x59, 0xff, 0xff, 0x4c, 0x79, 0x5c, 0xba, 0x75, 0x5c, 0x75, 0x5c, 0x4c, 0x79, 0x4c, 0x59, 0x54, 0x79, 0x96, 0x3f,
+  0x85, 0xde, 0x85, 0xde, 0x54, 0x79, 0x4c, 0x59, 0x54, 0x79, 0x96, 0x3f, 0x85, 0xde, 0x85, 0xde, 0x54, 0x79, 0x54, 0x79,
+  0x85, 0xbd, 0x9e, 0x7f, 0x96, 0x3f, 0x96, 0x3f, 0x4c, 0x79, 0x4c, 0x59, 0x96, 0x5f, 0x9e, 0x7f, 0x96, 0x5f, 0x96, 0x5f,
+  0x4c, 0x59, 0x54, 0x79, 0x75, 0x7c, 0x96, 0x5f, 0x75, 0x7c, 0x75, 0x7c, 0x54, 0x79, 0x4c, 0x79, 0x54, 0x79, 0x4c, 0x59,
+  0x54, 0x79, 0x54, 0x79, 0x44, 0x58, 0x4c, 0x79, 0x54, 0x79, 0x4c, 0x59, 0x54, 0x79, 0x54, 0x79, 0x44, 0x58, 0xff, 0xff,
+  0xff, 0xff, 0x54, 0x79, 0x4c, 0x59, 0x4c, 0x59, 0x4c, 0x59, 0xff, 0xff, 0x4c, 0x79, 0x5c, 0xba, 0x75, 0x5c, 0x75, 0x5c,
+  0x4c, 0x79, 0x4c, 0x59, 0x54, 0x79, 0x96, 0x3f, 0x85, 0xde, 0x85, 0xde, 0x54, 0x79, 0x4c, 0x59, 0x54, 0x79, 0x96, 0x3f,
+  0x85, 0xde, 0x85, 0xde, 0x54, 0x79, 0x54, 0x79, 0x85, 0xbd, 0x9e, 0x7f, 0x96, 0x3f, 0x96, 0x3f, 0x4c, 0x79, 0x4c, 0x59,
+  0x96, 0x5f, 0x9e, 0x7f, 0x96, 0x5f, 0x96, 0x5f, 0x4c, 0x59, 0x54, 0x79, 0x75, 0x7c, 0x96, 0x5f, 0x75, 0x7c, 0x75, 0x7c,
+  0x54, 0x79, 0x4c, 0x79, 0x54, 0x79, 0x4c, 0x59, 0x54, 0x79, 0x54, 0x79, 0x44, 0x58, 0x4c, 0x79, 0x54, 0x79, 0x4c, 0x59,
+  0x54, 0x79, 0x54, 0x79, 0x44, 0x58
+};
+
+const SpanBitmap rain_span = {50, 50, 8, rain_span_runs, rain_span_pixels};
+
+const Asset rain_asset = {"rain", ASSET_SPAN, 0, 50, 50, &rain_span};
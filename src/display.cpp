@@ -26,8 +26,10 @@
 #include "Adafruit_GFX.h"
 #include "Adafruit_RA8875.h"
 #include "Adafruit_I2CDevice.h"
+#include "ecoconsole.h"
 #include "display.h"
 #include "PanelBase.h"
+#include "PanelSet.h"
 #include "TemperaturePanel.h"
 #include "HumidityPanel.h"
 #include "HeaderPanel.h"
@@ -36,205 +38,896 @@
 #include "BaroPanel.h"
 #include "WindPanel.h"
 #include "FT5206.h"
+#include "rle.h"
+#include "glyphs.h"
+#include "DisplayList.h"
+#include "segment.h"
+#include "regshadow.h"
+#include "assetpack.h"
 
 Adafruit_RA8875 tft = Adafruit_RA8875(CS, RST);
 
-PanelList *first = NULL;
-TemperaturePanel *tp1, *tp2;
-HumidityPanel *hp1, *hp2;
-HeaderPanel *headp;
-ErrorPanel *ep;
-RainPanel *rp;
-BaroPanel *bp;
-WindPanel *wp;
+// Constructors only keep their arguments, the panels come to life in display_panels()
+static ErrorPanel errorPanel(&tft);
+static TemperaturePanel outdoorTemp(&tft, TEMP_OUTDOOR_X, TEMP_OUTDOOR_Y, 75.0, false);
+static TemperaturePanel indoorTemp(&tft, TEMP_INDOOR_X, TEMP_INDOOR_Y, 75.0, true);
+static HumidityPanel outdoorHum(&tft, HUM_OUTDOOR_X, HUM_OUTDOOR_Y, 50, false);
+static HumidityPanel indoorHum(&tft, HUM_INDOOR_X, HUM_INDOOR_Y, 50, true);
+static RainPanel rainPanel(&tft, RAIN_X, RAIN_Y);
+static BaroPanel baroPanel(&tft, BARO_X, BARO_Y);
+static WindPanel windPanel(&tft, WIND_X, WIND_Y);
+static HeaderPanel headerPanel(&tft);
+
+static auto panels = makePanelSet(outdoorTemp, indoorTemp, outdoorHum, indoorHum, rainPanel, baroPanel,
+  windPanel, headerPanel);
+static bool panelsReady = false;
 
 void resetTickerCallback(void);
 void dataTickerCallback(void);
 Ticker dataTimer(dataTickerCallback,300000); // 5 minutes
 Ticker resetTimer(resetTickerCallback,300000);
 
-static void waitForSignal(){
-  uint16_t count=0;
-  while(digitalRead(WAIT_PIN)!=1) {
-    if(++count==0)          // Timeout of ~9ms, normally this takes ~720uS for large fonts
-      break;
+#define MAX_DAMAGE_RECTS 24
+
+struct DamageRect {
+  uint16_t x;
+  uint16_t y;
+  uint16_t w;
+  uint16_t h;
+};
+
+static DamageRect damage[MAX_DAMAGE_RECTS];
+static uint8_t damageCount=0;
+static bool inFrame=false;
+static DamageStats damageStats;
+
+// Panels are drawn by the frame scheduler from displayLoop(), no more often than
+// FRAME_RATE and, past the first panel of a frame, only while the bytes the previous draws
+// of the panels cost fit in FRAME_SPI_BUDGET.  Whatever doesn't fit waits for the next
+// frame.  Override either with -D.
+#ifndef FRAME_RATE
+#define FRAME_RATE 10
+#endif
+#ifndef FRAME_SPI_BUDGET
+#define FRAME_SPI_BUDGET 96000   // ~40mS of pixel data at 20MHz
+#endif
+#define PANEL_COUNT (decltype(panels)::count)
+
+struct ScheduledPanel {
+  uint32_t cost;       // Bytes the last draw sent
+  bool dirty;
+  bool touched;        // Goes ahead of data updates
+};
+
+static ScheduledPanel schedule[PANEL_COUNT];
+static uint32_t lastFrame=0;
+static uint32_t frameBytes=0;   // Pixel bytes sent by bitmap writes, the cost of a draw
+
+// Where restores read the background from, picked by selectBackground().  A background
+// generated from assets/background.png carries its chrome flag with it.
+#ifndef ASSET_PACK_BACKGROUND
+#if defined(ASSET_BACKGROUND_FORMAT)
+#define builtinBackground background_asset
+#elif defined(LAYOUT_480x272)
+#error "The 480x272 layout needs the background from assets/assets-480x272.txt, background_bmp is 800x480"
+#elif defined(BACKGROUND_RLE)
+static const Asset builtinBackground = {"background", ASSET_RLE, 0, SCREEN_WIDTH, SCREEN_HEIGHT, &background_rle};
+#else
+static const Asset builtinBackground = {"background", ASSET_RAW, 0, SCREEN_WIDTH, SCREEN_HEIGHT, background_bmp};
+#endif
+#endif
+static const Asset *background = NULL;
+
+#ifdef DISPLAY_TWO_LAYER
+#define LAYER_OVERLAY 0x00       // Layer 1, displayed except where it holds the key colour
+#define LAYER_BACKGROUND 0x80    // Layer 2, BTE destination layer bit
+#define LAYER_CHUNK_PIXELS 64
+
+// Magenta, R=7 G=0 B=3 once the 8bpp colour registers drop the upper bits.  Nothing on
+// the panels is drawn in it, so it marks the transparent overlay pixels.
+#define OVERLAY_KEY_565 0x3803
+// The same key as layer memory holds it, built from the register fields rather than
+// rgb332(), which would take the top bits of each RGB565 field instead
+#define OVERLAY_KEY_332 (((OVERLAY_KEY_565 >> 11) << 5) | (((OVERLAY_KEY_565 >> 5) & 0x07) << 2) | (OVERLAY_KEY_565 & 0x03))
+
+static uint8_t bteLayer = LAYER_OVERLAY;
+
+static inline uint8_t rgb332(uint16_t c) {
+  return ((c>>8) & 0xe0) | ((c>>6) & 0x1c) | ((c>>3) & 0x03);
+}
+
+// 4x4 ordered dither, spreads the RGB565 -> RGB332 quantization error of the background
+static const uint8_t bayer4[4][4] = {
+  { 0,  8,  2, 10},
+  {12,  4, 14,  6},
+  { 3, 11,  1,  9},
+  {15,  7, 13,  5}
+};
+
+static uint8_t ditherRgb332(uint16_t c, uint8_t threshold) {
+  uint8_t r = (c>>8) & 0xf8;
+  uint8_t g = (c>>3) & 0xfc;
+  uint8_t b = (c<<3) & 0xf8;
+
+  r = min(255, r + (threshold<<1));     // R and G lose 5 bits, B loses 6
+  g = min(255, g + (threshold<<1));
+  b = min(255, b + (threshold<<2));
+
+  return (r & 0xe0) | ((g>>3) & 0x1c) | (b>>6);
+}
+#else
+static const uint8_t bteLayer = 0;
+#endif
+
+// Streamed uploads are sent by a task of the same priority as loop(), one chunk per time
+// slice.  The chunk still goes out with a blocking SPI write from a single buffer, there
+// is no DMA and on the single core C3 nothing overlaps, the task only splits a full screen
+// write into slices so MQTT, the web server and touch get a turn in between.
+#define STREAM_CHUNK_PIXELS 1024
+
+#define RLE_ASSET_CHUNK_PIXELS 64
+
+struct StreamedUpload {
+  const uint8_t *bitmap;     // RGB565 source, NULL streams the background instead
+  uint16_t x;
+  uint16_t y;
+  uint16_t w;
+  uint16_t h;
+  uint32_t next;             // Next pixel to send
+  uint32_t total;
+  DisplayCallback done;
+};
+
+static StreamedUpload upload;
+static volatile bool uploadBusy = false;
+static volatile bool uploadFinished = false;
+static TaskHandle_t uploadTask = NULL;
+static uint8_t uploadChunk[STREAM_CHUNK_PIXELS*2];
+
+// Queued text is fed to the CGROM one glyph per WAIT pin rising edge from displayLoop(),
+// so a panel can hand over all of its text and return.  Every other drawing call waits
+// for the queue to drain first, the controller can't take anything else mid glyph.
+#define TEXT_QUEUE_LEN 8
+#define TEXT_MAX_CHARS 24
+#define TEXT_JOB_CHARS 72         // Room for an error bar message
+#define GLYPH_TIMEOUT_US 9000     // Normally ~720uS for large fonts
+
+struct TextJob {
+  uint16_t x;
+  uint16_t y;
+  uint8_t font;
+  uint8_t enlarge;
+  uint16_t color;
+  char text[TEXT_JOB_CHARS];
+};
+
+static TextJob textQueue[TEXT_QUEUE_LEN];
+static uint8_t textHead = 0;
+static uint8_t textTail = 0;
+static const char *textNext = NULL;   // Next character of the job at textHead, NULL until started
+static bool glyphPending = false;
+static uint32_t glyphStart;
+static volatile bool glyphDone = false;
+
+static void restoreBackground(uint16_t x, uint16_t y, uint16_t w, uint16_t h);
+static void beginBitmapWrite(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool transparent);
+static void readBackground(uint16_t x, uint16_t y, uint16_t w, uint8_t *dst);
+static void endBitmapWrite(void);
+static void startStreamedUpload(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t *bitmap, DisplayCallback done);
+
+ICACHE_RAM_ATTR static void waitInterrupt() {
+  glyphDone = true;
+}
+
+// WAIT goes low while the CGROM renders a glyph, the rising edge marks it finished
+static bool glyphBusy() {
+  if(!glyphPending)
+    return false;
+
+  if(glyphDone || ((micros() - glyphStart) > GLYPH_TIMEOUT_US)) {
+    glyphPending = false;
+    return false;
   }
+
+  return true;
 }
 
-void drawCenteredArial(uint16_t centerx, uint16_t centery, int8_t value) {
-  setArialFont();
-  tft.textEnlarge(0);
+static void writeGlyph(char c) {
+  glyphDone = false;
+  tft.writeData(c);
+  glyphStart = micros();
+  glyphPending = true;
+}
 
-  uint8_t textLength=16;
+void drawCenteredArial(uint16_t centerx, uint16_t centery, int8_t value) {
+  uint8_t textLength=ARIAL_FIRST_DIGIT;
   if(abs(value)>99)
-    textLength+=20;
+    textLength+=ARIAL_DIGIT_WIDTH;
   if(abs(value) > 9)
-    textLength+=20;
+    textLength+=ARIAL_DIGIT_WIDTH;
 
   int16_t startx=centerx - textLength/2;
   if(value<0)                     // Space for the negitive sign
-    startx-=13;
+    startx-=ARIAL_SIGN_WIDTH;
     if(startx<0)
       startx=0;  
   
   char buffer[5];
-  tft.textSetCursor(startx,centery);
   itoa(value,buffer,10);
-  printString(buffer);
-
+  queueString(startx,centery,FONT_ARIAL,0,RA8875_WHITE,buffer);
 }
 
 void setError(const char *errStr) {
-  if(ep == NULL)
+  raiseError(errStr, ERROR_WARNING);
+}
+
+// Queued on the error panel, displayLoop() decides when the bar is repainted
+void raiseError(const char *errStr, uint8_t severity) {
+  if(!panelsReady)
     return;
 
-  ep->setMessage(errStr);
+  errorPanel.setMessage(errStr, severity);
   //log("errorpanel", errStr);
 }
 
 void clearError() {
-  if(ep == NULL)
+  if(!panelsReady)
     return;
 
-  ep->clearMessage();
+  errorPanel.clearMessage();
 }
 
-void setArialFont(){
+static void applyFont(uint8_t font) {
   tft.textMode();          // Resets font info, so don't run this after setting font
-  tft.writeReg(0x21,0x20); // Font Control Register, turn on external CGROM, bit 5
-  tft.writeReg(0x06,0x00); // Serial Flash CLK, SFCL=SystemClock
-  tft.writeReg(0x2e,0x82); // Font Write Type, 80=32x32, 5-0=font to font pixels
-  tft.writeReg(0x2f,0x91); // Serial Font Select, 80=GB2312 90=ASCII 8C=Unicode 84=GB12345 
-  tft.writeReg(0x29,0x05); // Font line spacing
-  tft.writeReg(0x05,0x28); // Serial Flash Rom Config
+  if(font == FONT_INTERNAL)
+    return;
+
+  RegBatch b;
+  batchBegin(&b);
+  batchForceWrite(&b,0x21,0x20); // Font Control Register, turn on external CGROM, bit 5
+  batchWrite(&b,0x06,0x00); // Serial Flash CLK, SFCL=SystemClock
+  batchWrite(&b,0x2e,(font == FONT_VALUE) ? 0x82 : (font == FONT_ARIAL) ? ARIAL_FONT_TYPE : 0x00); // Font Write Type, 40=24x24 80=32x32, 5-0=font to font pixels
+  batchWrite(&b,0x2f,0x91); // Serial Font Select, 80=GB2312 90=ASCII 8C=Unicode 84=GB12345 
+  batchWrite(&b,0x29,0x05); // Font line spacing
+  batchWrite(&b,0x05,0x28); // Serial Flash Rom Config
+  batchFlush(&b);
 }
 
-void setSmallArialFont(){
-  tft.textMode();          // Resets font info, so don't run this after setting font
-  tft.writeReg(0x21,0x20); // Font Control Register, turn on external CGROM, bit 5
-  tft.writeReg(0x06,0x00); // Serial Flash CLK, SFCL=SystemClock
-  tft.writeReg(0x2e,0x00); // Font Write Type, 80=32x32, 5-0=font to font pixels
-  tft.writeReg(0x2f,0x91); // Serial Font Select, 80=GB2312 90=ASCII 8C=Unicode 84=GB12345 
-  tft.writeReg(0x29,0x05); // Font line spacing
-  tft.writeReg(0x05,0x28); // Serial Flash Rom Config
+static void startTextJob(TextJob *job) {
+  applyFont(job->font);
+  tft.textEnlarge(job->enlarge);
+  tft.textTransparent(job->color);
+  tft.textSetCursor(job->x, job->y);
+  tft.writeCommand(RA8875_MRWC);
 }
 
-void printString(const char *s) {
+// Feed the next glyph of the queue whenever the CGROM has finished the previous one
+static void pumpText() {
+  while(textHead != textTail) {
+    if(glyphBusy())
+      return;
 
-  tft.writeCommand(RA8875_MRWC);
-  while(*s!=0) {
-      tft.writeData(*s);
-      ++s;
-      waitForSignal();
+    TextJob *job = &textQueue[textHead];
+    if(textNext == NULL) {
+      startTextJob(job);
+      textNext = job->text;
+    }
+
+    if(*textNext == 0) {
+      textHead = (textHead + 1) % TEXT_QUEUE_LEN;
+      textNext = NULL;
+      continue;
+    }
+
+    writeGlyph(*textNext++);
   }
 }
 
-void redrawBackgroundSection(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+void queueString(uint16_t x, uint16_t y, uint8_t font, uint8_t enlarge, uint16_t color, const char *s) {
+  while(uploadBusy)
+    vTaskDelay(1);
+
+  while(((textTail + 1) % TEXT_QUEUE_LEN) == textHead)
+    pumpText();
+
+  TextJob *job = &textQueue[textTail];
+  job->x = x;
+  job->y = y;
+  job->font = font;
+  job->enlarge = enlarge;
+  job->color = color;
+  strncpy(job->text, s, TEXT_JOB_CHARS-1);
+  job->text[TEXT_JOB_CHARS-1] = 0;
+
+  textTail = (textTail + 1) % TEXT_QUEUE_LEN;
+  pumpText();
+}
+
+static uint32_t rectArea(const DamageRect *r) {
+  return (uint32_t)r->w * r->h;
+}
 
-  if((h*w*2) > 200000) {
-    Serial.println("Memory Allocation too large in redrawBackgroundSection");
+static uint32_t overlapArea(const DamageRect *a, const DamageRect *b) {
+  int32_t x0 = max(a->x, b->x);
+  int32_t y0 = max(a->y, b->y);
+  int32_t x1 = min(a->x + a->w, b->x + b->w);
+  int32_t y1 = min(a->y + a->h, b->y + b->h);
+
+  if((x1<=x0)||(y1<=y0))
+    return 0;
+
+  return (uint32_t)(x1-x0) * (y1-y0);
+}
+
+static DamageRect unionRect(const DamageRect *a, const DamageRect *b) {
+  DamageRect u;
+  u.x = min(a->x, b->x);
+  u.y = min(a->y, b->y);
+  u.w = max(a->x + a->w, b->x + b->w) - u.x;
+  u.h = max(a->y + a->h, b->y + b->h) - u.y;
+  return u;
+}
+
+static bool containsRect(const DamageRect *outer, uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+  return (x >= outer->x) && (y >= outer->y) && 
+    ((x + w) <= (outer->x + outer->w)) && ((y + h) <= (outer->y + outer->h));
+}
+
+// Merge any pair that overlaps or touches so that its bounding box is exactly what the two
+// asked for.  A pixel neither asked for may belong to a panel that isn't drawn this frame,
+// restoring it would wipe that panel's value.  Repeat until nothing else merges.
+static void mergeDamage() {
+  bool merged = true;
+
+  while(merged) {
+    merged = false;
+    for(uint8_t i=0;(i<damageCount)&&!merged;i++) {
+      for(uint8_t j=i+1;j<damageCount;j++) {
+        DamageRect u = unionRect(&damage[i], &damage[j]);
+        uint32_t needed = rectArea(&damage[i]) + rectArea(&damage[j]) - overlapArea(&damage[i], &damage[j]);
+
+        if(rectArea(&u) == needed) {
+          damage[i] = u;
+          damage[j] = damage[--damageCount];
+          merged = true;
+          break;
+        }
+      }
+    }
+  }
+}
+
+static void flushDamage() {
+  mergeDamage();
+
+  for(uint8_t n=0;n<damageCount;n++) {
+    damageStats.mergedArea += rectArea(&damage[n]);
+    restoreBackground(damage[n].x, damage[n].y, damage[n].w, damage[n].h);
+  }
+  damageStats.mergedRects = damageCount;
+}
+
+void addDamage(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+  if((w==0)||(h==0))
+    return;
+
+  if(!inFrame) {
+    restoreBackground(x, y, w, h);
     return;
   }
 
-  uint8_t *bitmap=(uint8_t*)malloc(h*w*2);
-  
-  for(uint16_t n=0;n<h;n++) {
-    memcpy(&bitmap[w*n*2],&background_bmp[((y+n)*800+x)*2],w*2);
+  damageStats.rawArea += (uint32_t)w * h;
+  damageStats.rawRects++;
+
+  if(damageCount == MAX_DAMAGE_RECTS) {
+    mergeDamage();
+    if(damageCount == MAX_DAMAGE_RECTS) {
+      Serial.println("Damage list full, restoring immediately");
+      restoreBackground(x, y, w, h);
+      return;
+    }
   }
 
-  drawTransparentBitmap(x,y,w,h,bitmap); 
-  
-  free(bitmap);
+  damage[damageCount].x = x;
+  damage[damageCount].y = y;
+  damage[damageCount].w = w;
+  damage[damageCount].h = h;
+  damageCount++;
 }
 
-void display_panels() {
-  ep = new ErrorPanel(&tft);
-  ep->draw();
+// True when this frame's restores touched the rectangle, whatever was drawn there is gone
+bool damageOverlaps(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+  DamageRect r = {x, y, w, h};
+
+  if(!inFrame)
+    return false;
+
+  for(uint8_t n=0;n<damageCount;n++) {
+    if(overlapArea(&damage[n], &r) > 0)
+      return true;
+  }
+  return false;
+}
+
+const DamageStats *getDamageStats() {
+  return &damageStats;
+}
+
+void redrawBackgroundSection(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+  waitDisplayIdle();
+
+  if(inFrame) {
+    for(uint8_t n=0;n<damageCount;n++) {
+      if(containsRect(&damage[n], x, y, w, h)) {
+        damageStats.skippedRestores++;
+        return;
+      }
+    }
+  }
 
-  if(first==NULL) {
-    first = (PanelList *)malloc(sizeof(PanelList));
+  restoreBackground(x, y, w, h);
+}
+
+// The asset pack's background wins over the compiled in one, without either restores
+// fall back to black
+void selectBackground() {
+  background = assetPackFind("background");
+  if((background != NULL) && ((background->width != SCREEN_WIDTH) || (background->height != SCREEN_HEIGHT) ||
+    ((background->format != ASSET_RAW) && (background->format != ASSET_RLE)))) {
+    Serial.printf("Asset pack background is not a %dx%d raw or rle image, ignored\n", SCREEN_WIDTH, SCREEN_HEIGHT);
+    background = NULL;
   }
 
-  //log("temperature","Temp 1 Create");
-  tp1 = new TemperaturePanel(&tft, 0, 30, 75.0,false);
-  tp1->draw();
+#ifndef ASSET_PACK_BACKGROUND
+  if(background == NULL)
+    background = &builtinBackground;
+#endif
+}
 
-  //log("temperature","Temp 2 Create");
-  tp2 = new TemperaturePanel(&tft, 549, 30, 75.0,true);
-  tp2->draw();
+// With the chrome in the background a restore brings the borders and fixed labels back
+bool chromeBaked() {
+  return (background != NULL) && (background->flags & ASSET_FLAG_CHROME);
+}
 
-  //log("temperature","Hum 1 Create");
-  hp1 = new HumidityPanel(&tft,0,261,50,false);
-  hp1->draw();
+// Draw one group of a panel's chrome (Layout.h) for backgrounds without it baked in
+void drawChrome(uint16_t x, uint16_t y, const ChromeOp *ops, uint8_t count, uint8_t group, bool indoor) {
+  for(uint8_t n=0;n<count;n++) {
+    const ChromeOp *op = &ops[n];
+    if((op->group != group) || ((op->when == CHROME_INDOOR) && !indoor) || ((op->when == CHROME_OUTDOOR) && indoor))
+      continue;
+    if(op->type != CHROME_TEXT)
+      waitDisplayIdle();
+
+    switch(op->type) {
+      case CHROME_LINE:
+        tft.graphicsMode();
+        tft.drawLine(x+op->x, y+op->y, x+op->a, y+op->b, op->color);
+        break;
+      case CHROME_CURVE:
+        tft.graphicsMode();
+        tft.drawCurve(x+op->x, y+op->y, op->a, op->a, op->b, op->color);
+        break;
+      case CHROME_RECT:
+        tft.graphicsMode();
+        tft.drawRect(x+op->x, y+op->y, op->a, op->b, op->color);
+        break;
+      case CHROME_TEXT:
+        queueString(x+op->x, y+op->y, FONT_INTERNAL, 0, op->color, op->text);
+        break;
+      default:
+        break;
+    }
+  }
+}
 
-  hp2 = new HumidityPanel(&tft,549,261,50,true);
-  hp2->draw();
+static void readBackground(uint16_t x, uint16_t y, uint16_t w, uint8_t *dst) {
+  if(background == NULL) {
+    memset(dst, 0, w*2);
+  } else if(background->format == ASSET_RLE) {
+    RleCursor c;
+    rleSeek(&c, (const RleImage *)background->data, x, y);
+    rleRead(&c, dst, w);
+  } else {
+    memcpy(dst, &((const uint8_t *)background->data)[(y*SCREEN_WIDTH+x)*2], w*2);
+  }
+}
+
+// Restores of the regions in Layout.h's layoutTiles are sent from contiguous crops of the
+// compiled in background, generated with the "tiles" option in assets/assets.txt.  Only
+// an exact match counts, anything else reads the full image.
+#if !defined(DISPLAY_TWO_LAYER) || (VALUE_RENDERER == VALUE_RENDER_ATLAS)
+static const AssetTile *findTile(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+#if defined(ASSET_BACKGROUND_TILES) && !defined(ASSET_PACK_BACKGROUND)
+  if(background != &builtinBackground)
+    return NULL;
+
+  for(uint8_t n=0;n<ASSET_BACKGROUND_TILES;n++) {
+    const AssetTile *t = &background_tiles[n];
+    if((t->x == x) && (t->y == y) && (t->w == w) && (t->h == h))
+      return t;
+  }
+#else
+  (void)x; (void)y; (void)w; (void)h;
+#endif
+  return NULL;
+}
+#endif
+
+static void restoreBackground(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+#if VALUE_RENDERER == VALUE_RENDER_SEGMENT
+  segmentForget(x,y,w,h);
+#endif
+
+#if defined(DISPLAY_TWO_LAYER)
+  // The background lives in its own layer, uncovering it is a hardware fill of the overlay
+  tft.fillRect(x,y,w,h,OVERLAY_KEY_565);
+#else
+  const AssetTile *tile = findTile(x,y,w,h);
+  if(tile != NULL) {
+    beginBitmapWrite(x,y,w,h,false);
+    SPI.writeBytes(tile->data,(uint32_t)w*h*2);
+    endBitmapWrite();
+  } else if(background == NULL) {
+    tft.fillRect(x,y,w,h,RA8875_BLACK);
+  } else if(background->format == ASSET_RLE) {
+    beginBitmapWrite(x,y,w,h,false);
+    rleStreamRect((const RleImage *)background->data,x,y,w,h);
+    endBitmapWrite();
+  } else {
+    // Stream each row straight out of flash, the active window wraps the rows for us
+    const uint8_t *bmp = (const uint8_t *)background->data;
+    beginBitmapWrite(x,y,w,h,false);
+    for(uint16_t n=0;n<h;n++) {
+      SPI.writeBytes(&bmp[((y+n)*SCREEN_WIDTH+x)*2],w*2);
+    }
+    endBitmapWrite();
+  }
+#endif
+}
+
+#if VALUE_RENDERER == VALUE_RENDER_ATLAS
+#define VALUE_MAX_WIDTH 320
+#define VALUE_COLOR RA8875_WHITE
+
+// Blend two RGB565 pixels with the fields spread apart in a 32 bit word, alpha 0-32
+static inline uint16_t blend565(uint16_t bg, uint16_t fg, uint8_t alpha) {
+  uint32_t b = (bg | ((uint32_t)bg<<16)) & 0x07e0f81f;
+  uint32_t f = (fg | ((uint32_t)fg<<16)) & 0x07e0f81f;
+
+  b += ((f - b) * alpha) >> 5;
+  b &= 0x07e0f81f;
+  return (uint16_t)(b | (b>>16));
+}
+
+#define COMPOSE_BAND_ROWS 8
+#define COMPOSE_TRANSPARENT 0xffff  // White, transparent in every asset encoding
+
+// Rows being composited, RGB565 high byte first as they go out.  Word aligned so the
+// background is copied in 32 bits at a time.
+static uint32_t composeBand[VALUE_MAX_WIDTH*COMPOSE_BAND_ROWS/2];
+
+static inline uint16_t pixelAt(const uint8_t *p) {
+  return (p[0]<<8) | p[1];
+}
+
+static inline void putPixel(uint8_t *p, uint16_t c) {
+  p[0] = c>>8;
+  p[1] = c & 0xff;
+}
+
+// Copy the opaque pixels of a row of RGB565 into a composited row
+static void mergePixels(uint8_t *dst, const uint8_t *src, uint16_t n) {
+  for(uint16_t i=0;i<n;i++) {
+    if(pixelAt(&src[i*2]) != COMPOSE_TRANSPARENT) {
+      dst[i*2] = src[i*2];
+      dst[i*2+1] = src[i*2+1];
+    }
+  }
+}
+
+// Merge row y of an icon into a composited row starting at screen x linex
+static void composeIconRow(uint8_t *line, int16_t linex, uint16_t w, int16_t y, const ComposeIcon *icon) {
+  const Asset *asset = icon->asset;
+  int16_t iy = y - icon->y;
+  int16_t ix0 = max(0, linex - (int16_t)icon->x);
+  int16_t ix1 = min((int16_t)asset->width, (int16_t)(linex + w - icon->x));
+  if((iy < 0) || (iy >= asset->height) || (ix1 <= ix0))
+    return;
 
-  rp = new RainPanel(&tft,255,30);
-  rp -> draw();
+  uint8_t *dst = &line[(icon->x + ix0 - linex)*2];
+  uint16_t n = ix1 - ix0;
+
+  switch(asset->format) {
+    case ASSET_MONO: {
+      const MonoIcon *mono = (const MonoIcon *)asset->data;
+      uint16_t stride = (mono->width + 7) / 8;
+      for(uint8_t p=0;p<mono->planes;p++) {
+        const uint8_t *bits = &mono->plane[p].bits[iy*stride];
+        for(int16_t ix=ix0;ix<ix1;ix++) {
+          if(bits[ix>>3] & (0x80>>(ix&7)))
+            putPixel(&dst[(ix-ix0)*2], mono->plane[p].color);
+        }
+      }
+      break;
+    }
+    case ASSET_SPAN: {
+      const SpanBitmap *span = (const SpanBitmap *)asset->data;
+      if(span->runCount == 0) {
+        mergePixels(dst, &span->pixels[(iy*span->width + ix0)*2], n);
+        break;
+      }
+
+      const uint8_t *pixels = span->pixels;
+      for(uint16_t r=0;r<span->runCount;r++) {
+        const SpanRun *run = &span->runs[r];
+        int16_t rx0 = max(ix0, (int16_t)run->x);
+        int16_t rx1 = min(ix1, (int16_t)(run->x + run->w));
+        if((iy >= run->y) && (iy < run->y + run->h) && (rx1 > rx0))
+          mergePixels(&dst[(rx0-ix0)*2], &pixels[((iy-run->y)*run->w + rx0 - run->x)*2], rx1 - rx0);
+        pixels += run->w*run->h*2;
+      }
+      break;
+    }
+    case ASSET_RLE: {
+      uint8_t chunk[RLE_ASSET_CHUNK_PIXELS*2];
+      RleCursor c;
+      rleSeek(&c, (const RleImage *)asset->data, ix0, iy);
+      for(uint16_t done=0;done<n;) {
+        uint16_t k = min((uint16_t)(n - done), (uint16_t)RLE_ASSET_CHUNK_PIXELS);
+        rleRead(&c, chunk, k);
+        mergePixels(&dst[done*2], chunk, k);
+        done += k;
+      }
+      break;
+    }
+    default:
+      mergePixels(dst, &((const uint8_t *)asset->data)[(iy*asset->width + ix0)*2], n);
+      break;
+  }
+}
 
-  bp = new BaroPanel(&tft,255,160);
-  bp->draw();
+// The box is built a band of rows at a time: background rows (from a tile when one
+// matches), glyph coverage blended over them, then the icons on top.  Each finished band
+// goes out in one write, so every pixel crosses the bus once and nothing is drawn twice.
+static void composeValue(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t textx, uint16_t texty, const char *s,
+  const ComposeIcon *icons, uint8_t iconCount) {
+  const GlyphInfo *glyphs[TEXT_MAX_CHARS];
+  int16_t glyphx[TEXT_MAX_CHARS];
+  uint8_t count=0;
+  int16_t pen = textx - x;
+  uint8_t *band = (uint8_t *)composeBand;
+
+  w = min(w, (uint16_t)VALUE_MAX_WIDTH);
+  const AssetTile *tile = findTile(x,y,w,h);
+
+  for(;*s && count < TEXT_MAX_CHARS;s++) {
+    const GlyphInfo *g = glyphLookup(*s);
+    if(g == NULL)             // The atlas only has the characters values are printed with
+      continue;
+    glyphs[count] = g;
+    glyphx[count++] = pen;
+    pen += g->advance;
+  }
 
-  wp = new WindPanel(&tft,255,330);
-  wp->draw();
+  beginBitmapWrite(x,y,w,h,false);
+  for(uint16_t top=0;top<h;top+=COMPOSE_BAND_ROWS) {
+    uint16_t rows = min((uint16_t)(h - top), (uint16_t)COMPOSE_BAND_ROWS);
 
-  headp = new HeaderPanel(&tft);
-  headp->draw();
+    if(tile != NULL) {
+      memcpy(band, &tile->data[top*w*2], rows*w*2);
+    } else {
+      for(uint16_t r=0;r<rows;r++)
+        readBackground(x,y+top+r,w,&band[r*w*2]);
+    }
 
-  first->p = tp1;
-  PanelList *next = (PanelList *)malloc(sizeof(PanelList));
-  first->next = next;
+    for(uint16_t r=0;r<rows;r++) {
+      uint8_t *line = &band[r*w*2];
+      int16_t gy = y + top + r - texty;
+      if((gy >= 0) && (gy < GLYPH_HEIGHT)) {
+        for(uint8_t n=0;n<count;n++) {
+          uint8_t stride = (glyphs[n]->advance+1)/2;
+          const uint8_t *alpha = &glyph_alpha[glyphs[n]->offset + gy*stride];
+
+          for(uint8_t gx=0;gx<glyphs[n]->advance;gx++) {
+            int16_t px = glyphx[n] + gx;
+            uint8_t a = (gx & 1) ? (alpha[gx>>1] & 0x0f) : (alpha[gx>>1] >> 4);
+            if((a == 0) || (px < 0) || (px >= w))
+              continue;
+
+            putPixel(&line[px*2], blend565(pixelAt(&line[px*2]), VALUE_COLOR, (a*32 + GLYPH_MAX_ALPHA/2)/GLYPH_MAX_ALPHA));
+          }
+        }
+      }
+
+      for(uint8_t n=0;n<iconCount;n++)
+        composeIconRow(line, x, w, y + top + r, &icons[n]);
+    }
 
-  next->p = tp2;
-  PanelList *hnext = (PanelList *)malloc(sizeof(PanelList));
-  next->next=hnext;
-  hnext->p = hp1;
+#ifdef DISPLAY_TWO_LAYER
+    // Packed in place, each byte lands at or before the pixel it came from
+    for(uint16_t i=0;i<rows*w;i++)
+      band[i] = ditherRgb332(pixelAt(&band[i*2]), bayer4[(y+top+i/w)&3][(x+i%w)&3]);
+    SPI.writeBytes(band,rows*w);
+#else
+    SPI.writeBytes(band,rows*w*2);
+#endif
+  }
+  endBitmapWrite();
+}
+#endif
+
+// The atlas renderer rewrites the whole value box, so it never needs restoring first
+void addValueDamage(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+#if VALUE_RENDERER == VALUE_RENDER_CGROM
+  addDamage(x,y,w,h);
+#else
+  (void)x; (void)y; (void)w; (void)h;
+#endif
+}
 
-  next = (PanelList *)malloc(sizeof(PanelList));
-  hnext->next = next;
-  next->p = hp2;
+// Segments only touch the digit cells, anything else a panel prints inside its value box
+// has to be cleared separately
+void redrawValueBoxSection(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+#if VALUE_RENDERER == VALUE_RENDER_SEGMENT
+  redrawBackgroundSection(x,y,w,h);
+#else
+  (void)x; (void)y; (void)w; (void)h;
+#endif
+}
 
-  hnext = (PanelList *)malloc(sizeof(PanelList));
-  next->next = hnext;
-  hnext->p = rp;
+// Clear the box and draw a large value with its cell at textx, texty
+void drawLargeValue(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t textx, uint16_t texty, const char *s) {
+#if VALUE_RENDERER == VALUE_RENDER_ATLAS
+  waitDisplayIdle();
+  composeValue(x,y,w,h,textx,texty,s,NULL,0);
+#elif VALUE_RENDERER == VALUE_RENDER_SEGMENT
+  waitDisplayIdle();
+  segmentDrawValue(&tft,x,y,w,h,textx,texty,s);
+#else
+  redrawBackgroundSection(x,y,w,h);
+  queueString(textx,texty,FONT_VALUE,VALUE_FONT_ENLARGE,RA8875_WHITE,s);
+#endif
+}
 
-  next = (PanelList *)malloc(sizeof(PanelList));
-  hnext->next = next;
-  next->p = bp;
+// A large value with icons on top.  The atlas renderer composites them into the box in
+// the same pass, the others draw the icons over the finished value.
+void drawComposedValue(uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t textx, uint16_t texty, const char *s,
+  const ComposeIcon *icons, uint8_t iconCount) {
+#if VALUE_RENDERER == VALUE_RENDER_ATLAS
+  waitDisplayIdle();
+  composeValue(x,y,w,h,textx,texty,s,icons,iconCount);
+#else
+  drawLargeValue(x,y,w,h,textx,texty,s);
+  for(uint8_t n=0;n<iconCount;n++)
+    drawAsset(icons[n].x,icons[n].y,icons[n].asset);
+#endif
+}
 
-  hnext = (PanelList *)malloc(sizeof(PanelList));  
-  next->next=hnext;
-  hnext->p = wp;
+void display_panels() {
+  headerPanel.begin();
 
-  next = (PanelList *)malloc(sizeof(PanelList));
-  hnext->next = next;
-  next->p = headp; 
-  next->next=NULL;
+  for(uint8_t n=0;n<PANEL_COUNT;n++) {
+    schedule[n].cost = 0;
+    schedule[n].dirty = true;
+    schedule[n].touched = false;
+  }
+  panelsReady = true;
+}
 
+void schedulePanel(PanelBase *p, bool touched) {
+  int8_t n = panels.indexOf(p);
+  if(n < 0)
+    return;
 
+  schedule[n].dirty = true;
+  schedule[n].touched |= touched;
 }
 
+// Pick this frame's panels, touched ones first, then restore their merged damage once and
+// draw them in panel order.  The pick comes after the wait, which can finish an upload
+// whose callback draws panels itself.
+static void renderFrame(bool budgeted) {
+  bool pick[PANEL_COUNT];
+  uint32_t estimate = 0;
+  uint8_t picked = 0;
+
+  waitDisplayIdle();
+  memset(pick, 0, sizeof(pick));
+  for(uint8_t pass=0;pass<2;pass++) {
+    for(uint8_t n=0;n<PANEL_COUNT;n++) {
+      ScheduledPanel *sp = &schedule[n];
+      if(!sp->dirty || pick[n] || (sp->touched != (pass == 0)))
+        continue;
+      if(budgeted && (picked > 0) && (estimate + sp->cost > FRAME_SPI_BUDGET))
+        continue;
+
+      pick[n] = true;
+      estimate += sp->cost;
+      picked++;
+    }
+  }
+
+  if(picked == 0)
+    return;
+
+  memset(&damageStats, 0, sizeof(damageStats));
+  DisplayList::resetStats();
+  damageCount = 0;
+  inFrame = true;
+
+  // Collect every background region this frame will restore, then restore the merged set 
+  // once before any panel draws on top of it.
+  for(uint8_t n=0;n<PANEL_COUNT;n++) {
+    if(pick[n])
+      panels.reportDamage(n);
+  }
+  frameBytes = 0;
+  flushDamage();
+  uint32_t totalBytes = frameBytes;
+
+  for(uint8_t n=0;n<PANEL_COUNT;n++) {
+    if(!pick[n])
+      continue;
+
+    // Cleared first, a draw may leave its panel dirty again
+    schedule[n].dirty = false;
+    schedule[n].touched = false;
+    frameBytes = 0;
+    panels.draw(n);
+    schedule[n].cost = frameBytes;
+    totalBytes += frameBytes;
+  }
+
+  inFrame = false;
+
+#ifdef DISPLAY_FRAME_STATS
+  if(damageStats.rawRects > 0)
+    Serial.printf("Damage: %u rects %lu px, merged %u rects %lu px, %u restores skipped\n",
+      damageStats.rawRects, damageStats.rawArea, damageStats.mergedRects, damageStats.mergedArea,
+      damageStats.skippedRestores);
+
+  const DisplayListStats *ds = DisplayList::getStats();
+  if(ds->opsDrawn > 0)
+    Serial.printf("Display list: %u ops drawn, %u unchanged, %lu px\n", ds->opsDrawn, ds->opsSkipped, ds->pixels);
+
+  const ShadowStats *ss = getShadowStats();
+  Serial.printf("Frame: %u panels %lu bytes, registers %lu written, %lu skipped, %lu reads from shadow\n",
+    picked, totalBytes, ss->issued, ss->skipped, ss->readsServed);
+#else
+  (void)totalBytes;
+#endif
+}
+
+// Everything at once, outside the budget.  Used once the background is in.
 void drawAll() {
-  dataTimer.stop();
-  dataTimer.start();
+  for(uint8_t n=0;n<PANEL_COUNT;n++)
+    schedule[n].dirty = true;
+
+  renderFrame(false);
+}
 
-  if (first==NULL)
+static void frameLoop() {
+  if((millis() - lastFrame) < (1000 / FRAME_RATE))
     return;
 
-  PanelList *p = first;
-  while(p!=NULL) {
-    p->p->draw();
-    p = p->next;
-  }  
+  lastFrame = millis();
+  renderFrame(true);
+}
 
+// New station data restarts the no data timeout
+static bool updated(PanelBase *p) {
+  dataTimer.stop();
+  dataTimer.start();
+
+  schedulePanel(p, false);
+  return true;
 }
 
 void conversionError(const char *column, char *value) {
   char error[50];
 
   sprintf(error,"Bad conversion for %s %s", column, value);
-  setError(error);
+  raiseError(error, ERROR_INFO);
 }
 
 bool setData(char *name, char *value) {
@@ -243,8 +936,8 @@ bool setData(char *name, char *value) {
     char *ending;
     float rain = strtof(value,&ending);
     if(*ending==0) {
-      rp->setDailyRain(rain);
-      return true;
+      rainPanel.setDailyRain(rain);
+      return updated(&rainPanel);
     } else { 
       conversionError("drain_piezo",value);
       return false;
@@ -255,8 +948,8 @@ bool setData(char *name, char *value) {
     char *ending;
     float rain = strtof(value,&ending);
     if(*ending==0) {
-      rp->setWeeklyRain(rain);
-      return true;
+      rainPanel.setWeeklyRain(rain);
+      return updated(&rainPanel);
     } else {
       conversionError("wrain_piezo",value);
       return false;
@@ -267,8 +960,8 @@ bool setData(char *name, char *value) {
     char *ending;
     float rain = strtof(value,&ending);
     if(*ending==0) {
-      rp->setMonthlyRain(rain);
-      return true;
+      rainPanel.setMonthlyRain(rain);
+      return updated(&rainPanel);
     } else { 
       conversionError("mrain_piezo",value);
 
@@ -280,8 +973,8 @@ bool setData(char *name, char *value) {
     char *ending;
     float rain = strtof(value,&ending);
     if(*ending==0) {
-      rp->setYearlyRain(rain);
-      return true;
+      rainPanel.setYearlyRain(rain);
+      return updated(&rainPanel);
     } else { 
       conversionError("yrain_piezo",value);
       return false;
@@ -292,8 +985,8 @@ bool setData(char *name, char *value) {
     char *ending;
     float humidity = strtof(value,&ending);
     if(*ending==0) {
-      hp1->setHumidity(humidity);
-      return true;
+      outdoorHum.setHumidity(humidity);
+      return updated(&outdoorHum);
     } else { 
       conversionError("humidity",value);
       return false;
@@ -304,8 +997,8 @@ bool setData(char *name, char *value) {
     char *ending;
     float dew = strtof(value,&ending);
     if(*ending==0) {
-      hp1->setDewPoint(dew);
-      return true;
+      outdoorHum.setDewPoint(dew);
+      return updated(&outdoorHum);
     } else { 
       conversionError("dew_point",value);
       return false;
@@ -316,8 +1009,8 @@ bool setData(char *name, char *value) {
     char *ending;
     float humidity = strtof(value,&ending);
     if(*ending==0) {
-      hp2->setHumidity(humidity);
-      return true;
+      indoorHum.setHumidity(humidity);
+      return updated(&indoorHum);
     } else { 
       conversionError("humidityin",value);
       return false;
@@ -328,8 +1021,8 @@ bool setData(char *name, char *value) {
     char *ending;
     float temp= strtof(value,&ending);
     if(*ending==0) {
-      tp1->setTemperature(temp);
-      return true;
+      outdoorTemp.setTemperature(temp);
+      return updated(&outdoorTemp);
     } else { 
       conversionError("temp",value);
       return false;
@@ -340,8 +1033,8 @@ bool setData(char *name, char *value) {
     char *ending;
     float feels = strtof(value,&ending);
     if(*ending==0) {
-      tp1->setFeelsLike(feels);
-      return true;
+      outdoorTemp.setFeelsLike(feels);
+      return updated(&outdoorTemp);
     } else { 
       conversionError("feelslike",value);
       return false;
@@ -352,8 +1045,8 @@ bool setData(char *name, char *value) {
     char *ending;
     float temp = strtof(value,&ending);
     if(*ending==0) {
-      tp2->setTemperature(temp);
-      return true;
+      indoorTemp.setTemperature(temp);
+      return updated(&indoorTemp);
     } else { 
       conversionError("tempin",value);
       return false;
@@ -364,8 +1057,8 @@ bool setData(char *name, char *value) {
     char *ending;
     float wind = strtof(value,&ending);
     if(*ending==0) {
-      wp->setWind(wind);
-      return true;
+      windPanel.setWind(wind);
+      return updated(&windPanel);
     } else { 
       conversionError("windspeed",value);
       return false;
@@ -376,8 +1069,8 @@ bool setData(char *name, char *value) {
     char *ending;
     float gust = strtof(value,&ending);
     if(*ending==0) {
-      wp->setGust(gust);
-      return true;
+      windPanel.setGust(gust);
+      return updated(&windPanel);
     } else { 
       conversionError("windgust",value);
       return false;
@@ -388,8 +1081,8 @@ bool setData(char *name, char *value) {
     char *ending;
     float maxGust = strtof(value,&ending);
     if(*ending==0) {
-      wp->setMaxGust(maxGust);
-      return true;
+      windPanel.setMaxGust(maxGust);
+      return updated(&windPanel);
     } else { 
       conversionError("maxdailygust",value);
       return false;
@@ -397,16 +1090,16 @@ bool setData(char *name, char *value) {
   }
 
   if(strcmp("winddir_name",name)==0) {
-    wp->setDirection(value);
-    return true;
+    windPanel.setDirection(value);
+    return updated(&windPanel);
   }
 
   if(strcmp("wh90batt", name)==0) {
     char *ending;
     float batt = strtof(value,&ending);
     if(*ending==0) {
-      headp->setBatteryLevel(batt);
-      return true;
+      headerPanel.setBatteryLevel(batt);
+      return updated(&headerPanel);
     } else { 
       conversionError("wh90batt",value);
       return false;
@@ -417,8 +1110,8 @@ bool setData(char *name, char *value) {
     char *ending;
     float baro = strtof(value,&ending);
     if(*ending==0) {
-      bp->setPressure(baro);
-      return true;
+      baroPanel.setPressure(baro);
+      return updated(&baroPanel);
     } else { 
       conversionError("baromrel",value);
       return false;
@@ -428,65 +1121,431 @@ bool setData(char *name, char *value) {
   return false;
 }
 
-void drawTransparentBitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t *bitmap) {
+// Destination window of a BTE write, bit 7 of 0x5B selects the destination layer
+static void batchBteWindow(RegBatch *b, uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+  batchWrite(b,0x58,x & 0xff);
+  batchWrite(b,0x59,(x>>8));
+  batchWrite(b,0x5A,y & 0xff);
+  batchWrite(b,0x5B,(y>>8) | bteLayer);
+  batchWrite(b,0x5C,w & 0xff);
+  batchWrite(b,0x5D, (w>>8));  
+  batchWrite(b,0x5E,h & 0xff);
+  batchWrite(b,0x5F,(h>>8));
+}
 
-  tft.writeReg(0x58,x & 0xff);
-  tft.writeReg(0x59,(x>>8));
-  tft.writeReg(0x5A,y & 0xff);
-  tft.writeReg(0x5B,(y>>8));
-  tft.writeReg(0x5C,w & 0xff);
-  tft.writeReg(0x5D, (w>>8));  
-  tft.writeReg(0x5E,h & 0xff);
-  tft.writeReg(0x5F,(h>>8));
-
-  // White is the transparent color
-  tft.writeReg(0x63,0xff);
-  tft.writeReg(0x64,0xff);
-  tft.writeReg(0x65,0xff); 
-
-  tft.writeReg(0x51,0xc4);
-  uint8_t reg=tft.readReg(0x50);
-  reg=reg|0x80;
-  tft.writeReg(0x50,reg);
+// Colour setters in the Adafruit library share these registers, so they can never be skipped
+static void batchForeground(RegBatch *b, uint16_t color) {
+#ifdef DISPLAY_TWO_LAYER
+  uint8_t c = rgb332(color);       // 8bpp colour registers are RGB332 fields
+  batchForceWrite(b,0x63,c>>5);
+  batchForceWrite(b,0x64,(c>>2) & 0x07);
+  batchForceWrite(b,0x65,c & 0x03); 
+#else
+  batchForceWrite(b,0x63,color>>11);
+  batchForceWrite(b,0x64,(color>>5) & 0x3f);
+  batchForceWrite(b,0x65,color & 0x1f); 
+#endif
+}
 
-  tft.writeCommand(RA8875_MRWC);
+// Start the BTE operation and leave CS asserted for the data that follows
+static void startBteWrite(RegBatch *b, uint8_t rop) {
+  batchWrite(b,0x51,rop);
+  uint8_t reg=shadowReadReg(0x50);
+  reg=reg|0x80;
+  batchTrigger(b,0x50,reg,0x80);  // BTE enable clears itself once the write completes
 
+  batchCommand(b,RA8875_MRWC);
+  batchFlush(b);
 
   digitalWrite(CS,LOW);
 
   SPI.beginTransaction(SPISettings(20000000UL, MSBFIRST, SPI_MODE0));
   SPI.transfer(RA8875_DATAWRITE);
-   
-  SPI.writeBytes(bitmap,h*w*2);   
+}
+
+// A transparent write leaves the display untouched wherever the bitmap is white, background
+// restores have to be opaque or white background pixels would keep whatever was drawn there
+static void beginBitmapWrite(uint16_t x, uint16_t y, uint16_t w, uint16_t h, bool transparent) {
+  RegBatch b;
+  batchBegin(&b);
+
+#ifdef DISPLAY_TWO_LAYER
+  frameBytes += (uint32_t)w*h;
+#else
+  frameBytes += (uint32_t)w*h*2;
+#endif
+
+  batchBteWindow(&b,x,y,w,h);
+  batchForeground(&b,RA8875_WHITE);   // White is the transparent color
+  startBteWrite(&b,transparent ? 0xc4 : 0xc0);  // ROP=S, BTE write with/without transparency
+}
 
+static void endBitmapWrite() {
   SPI.endTransaction();
   digitalWrite(CS,HIGH);
+}
+
+// Send RGB565 pixels into an open bitmap write, converting to RGB332 in two layer mode
+static void writePixels(const uint8_t *bitmap, uint32_t pixels) {
+#ifdef DISPLAY_TWO_LAYER
+  uint8_t chunk[LAYER_CHUNK_PIXELS];
 
+  while(pixels > 0) {
+    uint16_t n = min(pixels, (uint32_t)LAYER_CHUNK_PIXELS);
+    for(uint16_t i=0;i<n;i++) {
+      chunk[i] = rgb332((bitmap[0]<<8) | bitmap[1]);
+      bitmap += 2;
+    }
+    SPI.writeBytes(chunk, n);
+    pixels -= n;
+  }
+#else
+  SPI.writeBytes(bitmap,pixels*2);   
+#endif
 }
 
+void drawTransparentBitmap(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t *bitmap) {
+  waitDisplayIdle();
+
+  beginBitmapWrite(x,y,w,h,true);
+  writePixels(bitmap,(uint32_t)w*h);
+  endBitmapWrite();
+
+}
+
+// Only the rectangles covering opaque pixels go out.  The colour key and ROP are set for
+// the first one, after that a window is its position, size and the BTE start.
+void drawSpanBitmap(uint16_t x, uint16_t y, const SpanBitmap *bitmap) {
+  if(bitmap->runCount == 0) {
+    drawTransparentBitmap(x,y,bitmap->width,bitmap->height,bitmap->pixels);
+    return;
+  }
+
+  waitDisplayIdle();
+
+  const uint8_t *pixels = bitmap->pixels;
+  for(uint16_t n=0;n<bitmap->runCount;n++) {
+    const SpanRun *r = &bitmap->runs[n];
+    RegBatch b;
+    batchBegin(&b);
+
+    batchBteWindow(&b,x+r->x,y+r->y,r->w,r->h);
+    if(n == 0)
+      batchForeground(&b,RA8875_WHITE);
+    startBteWrite(&b,0xc4);
+
+    uint32_t area = (uint32_t)r->w*r->h;
+#ifdef DISPLAY_TWO_LAYER
+    frameBytes += area;
+#else
+    frameBytes += area*2;
+#endif
+    writePixels(pixels,area);
+    pixels += area*2;
+    endBitmapWrite();
+  }
+}
+
+// One colour expansion per plane, the MCU sends a bit per pixel and the BTE writes the
+// foreground colour wherever it is set.  Between planes only the colour changes.
+void drawMonoIcon(uint16_t x, uint16_t y, const MonoIcon *icon) {
+  uint16_t stride = (icon->width + 7) / 8;
+
+  waitDisplayIdle();
+
+  for(uint8_t n=0;n<icon->planes;n++) {
+    RegBatch b;
+    batchBegin(&b);
+
+    batchBteWindow(&b,x,y,icon->width,icon->height);
+    batchForeground(&b,icon->plane[n].color);
+    startBteWrite(&b,0x79);     // Start at bit 7, colour expansion with transparency
+
+    SPI.writeBytes(icon->plane[n].bits,stride*icon->height);
+    endBitmapWrite();
+    frameBytes += stride*icon->height;
+  }
+}
+
+// Copy a rectangle within display memory.  The positive direction move reads left to right,
+// top to bottom, so it is only safe for moves up or to the left.
+void moveRect(uint16_t srcx, uint16_t srcy, uint16_t w, uint16_t h, uint16_t dstx, uint16_t dsty) {
+  waitDisplayIdle();
+
+  RegBatch b;
+  batchBegin(&b);
+  batchWrite(&b,0x54,srcx & 0xff);
+  batchWrite(&b,0x55,srcx>>8);
+  batchWrite(&b,0x56,srcy & 0xff);
+  batchWrite(&b,0x57,(srcy>>8) | bteLayer);
+  batchBteWindow(&b,dstx,dsty,w,h);
+  batchWrite(&b,0x51,0xc2);       // ROP=S, move in the positive direction
+  uint8_t reg=shadowReadReg(0x50);
+  batchTrigger(&b,0x50,reg|0x80,0x80);
+  batchFlush(&b);
+
+  tft.waitPoll(0x50,0x80);
+}
+
+// Row indexed RLE decoded a chunk at a time into a transparent write
+static void drawRleBitmap(uint16_t x, uint16_t y, const RleImage *img) {
+  uint8_t chunk[RLE_ASSET_CHUNK_PIXELS*2];
+  RleCursor c;
+
+  waitDisplayIdle();
+
+  beginBitmapWrite(x,y,img->width,img->height,true);
+  for(uint16_t row=0;row<img->height;row++) {
+    rleSeek(&c, img, 0, row);
+
+    uint16_t left = img->width;
+    while(left > 0) {
+      uint16_t n = min(left, (uint16_t)RLE_ASSET_CHUNK_PIXELS);
+      rleRead(&c, chunk, n);
+      writePixels(chunk, n);
+      left -= n;
+    }
+  }
+  endBitmapWrite();
+}
+
+// Generated assets (bitmaps.h) carry the encoding tools/assetgen.cpp picked for them, an
+// asset pack entry of the same name is drawn instead
+void drawAsset(uint16_t x, uint16_t y, const Asset *asset) {
+  asset = assetPackResolve(asset);
+
+  switch(asset->format) {
+    case ASSET_RLE:
+      drawRleBitmap(x,y,(const RleImage *)asset->data);
+      break;
+    case ASSET_MONO:
+      drawMonoIcon(x,y,(const MonoIcon *)asset->data);
+      break;
+    case ASSET_SPAN:
+      drawSpanBitmap(x,y,(const SpanBitmap *)asset->data);
+      break;
+    default:
+      drawTransparentBitmap(x,y,asset->width,asset->height,(const uint8_t *)asset->data);
+      break;
+  }
+}
+
+// Fill the next chunk of an upload, converting to RGB332 in two layer mode
+static uint16_t fillUploadChunk() {
+  uint32_t pixels = min(upload.total - upload.next, (uint32_t)STREAM_CHUNK_PIXELS);
+
+  if(upload.bitmap != NULL) {
+    memcpy(uploadChunk, &upload.bitmap[upload.next*2], pixels*2);
+  } else {
+    uint32_t done = 0;
+    while(done < pixels) {
+      uint16_t row = (upload.next + done) / upload.w;
+      uint16_t col = (upload.next + done) % upload.w;
+      uint16_t n = min(pixels - done, (uint32_t)(upload.w - col));
+      readBackground(upload.x + col, upload.y + row, n, &uploadChunk[done*2]);
+      done += n;
+    }
+  }
+  upload.next += pixels;
+
+#ifdef DISPLAY_TWO_LAYER
+  for(uint16_t i=0;i<pixels;i++)
+    uploadChunk[i] = rgb332((uploadChunk[i*2]<<8) | uploadChunk[i*2+1]);
+  return pixels;
+#else
+  return pixels*2;
+#endif
+}
+
+// The memory write started by beginBitmapWrite() carries on across chip selects as long
+// as no other command is issued, which is what the busy flag guarantees
+static void uploadTaskLoop(void *param) {
+  for(;;) {
+    ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+    while(upload.next < upload.total) {
+      uint16_t len = fillUploadChunk();
+
+      digitalWrite(CS,LOW);
+      SPI.beginTransaction(SPISettings(20000000UL, MSBFIRST, SPI_MODE0));
+      SPI.transfer(RA8875_DATAWRITE);
+      SPI.writeBytes(uploadChunk, len);
+      SPI.endTransaction();
+      digitalWrite(CS,HIGH);
+
+      taskYIELD();
+    }
+
+    uploadBusy = false;
+    uploadFinished = true;
+  }
+}
+
+static void startStreamedUpload(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t *bitmap, DisplayCallback done) {
+  waitDisplayIdle();
+
+  if(uploadTask == NULL)
+    xTaskCreate(uploadTaskLoop, "displayUpload", 2048, NULL, 1, &uploadTask);
+
+  upload.bitmap = bitmap;
+  upload.x = x;
+  upload.y = y;
+  upload.w = w;
+  upload.h = h;
+  upload.next = 0;
+  upload.total = (uint32_t)w*h;
+  upload.done = done;
+
+  beginBitmapWrite(x,y,w,h,bitmap != NULL);
+  endBitmapWrite();
+
+  uploadBusy = true;
+  xTaskNotifyGive(uploadTask);
+}
+
+void drawTransparentBitmapStreamed(uint16_t x, uint16_t y, uint16_t w, uint16_t h, const uint8_t *bitmap, DisplayCallback done) {
+  startStreamedUpload(x,y,w,h,bitmap,done);
+}
+
+bool displayBusy() {
+  return uploadBusy || (textHead != textTail) || glyphPending;
+}
+
+static void finishUpload() {
+  if(!uploadFinished)
+    return;
+
+  uploadFinished = false;
+  if(upload.done != NULL)
+    upload.done();
+}
+
+void waitDisplayIdle() {
+  while(uploadBusy)
+    vTaskDelay(1);
+
+  while((textHead != textTail) || glyphBusy())
+    pumpText();
+
+  finishUpload();
+}
+
+#define READBACK_SPI_CLOCK 10000000UL    // Reads don't keep up with the write clock
+
+// Read w pixels of display memory at x, y, one byte each at 8bpp, two high byte first at 16
+static void readMemory(uint16_t x, uint16_t y, uint16_t w, uint8_t *dst, uint8_t bytesPerPixel) {
+  RegBatch b;
+  batchBegin(&b);
+  batchWrite(&b,0x45,0x00);         // MRCD, left to right then top to bottom
+  batchForceWrite(&b,0x4A,x & 0xff);  // Memory read cursor, moves with every read so the
+  batchForceWrite(&b,0x4B,x>>8);      // shadow never holds what the chip has
+  batchForceWrite(&b,0x4C,y & 0xff);
+  batchForceWrite(&b,0x4D,y>>8);
+  batchCommand(&b,RA8875_MRWC);
+  batchFlush(&b);
+
+  digitalWrite(CS,LOW);
+  SPI.beginTransaction(SPISettings(READBACK_SPI_CLOCK, MSBFIRST, SPI_MODE0));
+  SPI.transfer(RA8875_DATAREAD);
+  SPI.transfer(0);                  // The first read after moving the cursor is a dummy
+  SPI.transferBytes(NULL,dst,(uint32_t)w*bytesPerPixel);
+  SPI.endTransaction();
+  digitalWrite(CS,HIGH);
+}
+
+// One row of what the panel shows as RGB565, high byte first.  In two layer
+// mode both layers are read and the background shows through the overlay key.
+void readScreenRow(uint16_t y, uint8_t *dst) {
+  waitDisplayIdle();
+
+#ifdef DISPLAY_TWO_LAYER
+  static uint8_t overlay[SCREEN_WIDTH];
+  static uint8_t under[SCREEN_WIDTH];
+  const uint8_t key = OVERLAY_KEY_332;
+
+  shadowWriteReg(0x41,shadowReadReg(0x41) | 0x01); // MWCR1, layer 2
+  readMemory(0,y,SCREEN_WIDTH,under,1);
+  shadowWriteReg(0x41,shadowReadReg(0x41) & 0xfe); // MWCR1, back to layer 1
+  readMemory(0,y,SCREEN_WIDTH,overlay,1);
+
+  for(uint16_t x=0;x<SCREEN_WIDTH;x++) {
+    uint8_t c = (overlay[x] == key) ? under[x] : overlay[x];
+    uint16_t px = ((c & 0xe0)<<8) | ((c & 0x1c)<<6) | ((c & 0x03)<<3);
+    dst[x*2] = px>>8;
+    dst[x*2+1] = px & 0xff;
+  }
+#else
+  readMemory(0,y,SCREEN_WIDTH,dst,2);
+#endif
+}
+
+#ifdef DISPLAY_TWO_LAYER
+static void initLayers() {
+  shadowWriteReg(0x10,0x00);                     // SYSR, 8bpp colour depth, 8 bit MCU interface
+  shadowWriteReg(0x20,shadowReadReg(0x20) | 0x80); // DPCR, two layers
+  shadowWriteReg(0x52,0x03);                     // LTPR0, transparent mode, layer 2 shows through the key
+  shadowWriteReg(0x67,OVERLAY_KEY_565 >> 11);    // BGTR, transparent key in RGB332 fields
+  shadowWriteReg(0x68,(OVERLAY_KEY_565 >> 5) & 0x3f);
+  shadowWriteReg(0x69,OVERLAY_KEY_565 & 0x1f);
+}
+
+// Quantize the background into layer 2 once, every later restore is a fill of layer 1
+void background_panel() {
+  uint8_t row[LAYER_CHUNK_PIXELS*2];
+  uint8_t chunk[LAYER_CHUNK_PIXELS];
+
+  bteLayer = LAYER_BACKGROUND;
+  shadowWriteReg(0x41,shadowReadReg(0x41) | 0x01); // MWCR1, write to layer 2
+  beginBitmapWrite(0,0,SCREEN_WIDTH,SCREEN_HEIGHT,false);
+  for(uint16_t y=0;y<SCREEN_HEIGHT;y++) {
+    for(uint16_t x=0;x<SCREEN_WIDTH;x+=LAYER_CHUNK_PIXELS) {
+      uint16_t n = min(SCREEN_WIDTH-x, LAYER_CHUNK_PIXELS);
+      readBackground(x,y,n,row);
+      for(uint16_t i=0;i<n;i++)
+        chunk[i] = ditherRgb332((row[i*2]<<8) | row[i*2+1], bayer4[y&3][(x+i)&3]);
+      SPI.writeBytes(chunk,n);
+    }
+  }
+  endBitmapWrite();
+
+  bteLayer = LAYER_OVERLAY;
+  shadowWriteReg(0x41,shadowReadReg(0x41) & 0xfe); // MWCR1, back to layer 1
+  tft.fillScreen(OVERLAY_KEY_565);
+
+  drawAll();
+}
+#else
+// Panels are drawn once the background is in, setup() carries on with WiFi meanwhile
 void background_panel() {
-  drawTransparentBitmap(0,0,800,480,background_bmp);
+  startStreamedUpload(0,0,SCREEN_WIDTH,SCREEN_HEIGHT,NULL,drawAll);
 }
+#endif
 
 void tftCTPTouch(uint16_t x, uint16_t y) {
   resetTimer.stop(); // reset timer that puts everything back to Daily extremes after 5 minutes
   resetTimer.start();
 
-  if (first==NULL)
+  waitDisplayIdle();
+  if(!panelsReady)
     return;
 
-  PanelList *p = first;
-  while(p!=NULL) {
-    if(p->p->isClicked(x,y))
-      break;
-    p = p->next;
-  }  
-
+  panels.isClicked(x,y);
 }
 void displayLoop(void) {
 
+  finishUpload();
+  pumpText();
+
   checkTouch();
 
+  // Panel updates and frames wait for the display, so the boot background upload and
+  // queued text carry on without loop() blocking on them
+  if(panelsReady && !displayBusy()) {
+    headerPanel.update();
+    errorPanel.update();
+    frameLoop();
+  }
+
   dataTimer.update();
   resetTimer.update();
 }
@@ -499,28 +1558,36 @@ void resetTickerCallback() {
 
 void dataTickerCallback() {
   Serial.println("!!!!!!!!Data Timeout!!!!!!!!!!");
-  ep->setMessage("Error: No Data from station in 5 Minutes");
+  raiseError("Error: No Data from station in 5 Minutes", ERROR_CRITICAL);
 }
 
 void initDisplay() {
   Serial.println("Display Start");
-  if(!tft.begin(RA8875_800x480)) {
+  if(!tft.begin(LAYOUT_RA8875_SIZE)) {
     Serial.println("Failed");
     return;
   }
 
+  shadowInit(&tft,CS);
   tft.displayOn(true);
   tft.GPIOX(true);
   tft.PWM1config(true,RA8875_PWM_CLK_DIV1024);
   tft.PWM1out(128);
 
+#ifdef DISPLAY_TWO_LAYER
+  initLayers();
+#endif
   tft.fillScreen(RA8875_BLACK);
 
   pinMode(WAIT_PIN,INPUT);
+  attachInterrupt(digitalPinToInterrupt(WAIT_PIN),waitInterrupt,RISING);
   ft5206_init();
 
-  background_panel();
+  assetPackBegin();
+  selectBackground();
+
   display_panels();
+  background_panel();
   dataTimer.start();
   resetTimer.start();
 }
\ No newline at end of file
@@ -0,0 +1,230 @@
+// Generated by tools/glyphgen.cpp, do not edit
+#include <Arduino.h>
+#include "glyphs.h"
+
+#if GLYPH_HEIGHT == 32
+
+const uint8_t glyph_alpha[] = {
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xee, 0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff,
+  0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xf7, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf9, 0x11, 0x9f,
+  0xff, 0x30, 0x00, 0x00, 0x0a, 0xff, 0xa0, 0x00, 0x0a, 0xff, 0xa0, 0x00, 0x00, 0x2f, 0xff, 0x10, 0x00, 0x01, 0xff, 0xf2,
+  0x00, 0x00, 0x8f, 0xf9, 0x00, 0x00, 0x00, 0x9f, 0xf8, 0x00, 0x00, 0xcf, 0xf4, 0x00, 0x00, 0x00, 0x4f, 0xfc, 0x00, 0x00,
+  0xff, 0xe0, 0x00, 0x00, 0x00, 0x0e, 0xff, 0x00, 0x03, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x0b, 0xff, 0x30, 0x05, 0xff, 0x90,
+  0x00, 0x00, 0x00, 0x09, 0xff, 0x50, 0x06, 0xff, 0x80, 0x00, 0x00, 0x00, 0x08, 0xff, 0x60, 0x07, 0xff, 0x80, 0x00, 0x00,
+  0x00, 0x08, 0xff, 0x70, 0x06, 0xff, 0x80, 0x00, 0x00, 0x00, 0x08, 0xff, 0x60, 0x06, 0xff, 0x80, 0x00, 0x00, 0x00, 0x08,
+  0xff, 0x60, 0x04, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x0a, 0xff, 0x40, 0x02, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x0c, 0xff, 0x20,
+  0x00, 0xef, 0xf1, 0x00, 0x00, 0x00, 0x1f, 0xfe, 0x00, 0x00, 0xaf, 0xf6, 0x00, 0x00, 0x00, 0x6f, 0xfa, 0x00, 0x00, 0x5f,
+  0xfc, 0x00, 0x00, 0x00, 0xcf, 0xf5, 0x00, 0x00, 0x0e, 0xff, 0x50, 0x00, 0x05, 0xff, 0xe0, 0x00, 0x00, 0x07, 0xff, 0xe2,
+  0x00, 0x2e, 0xff, 0x70, 0x00, 0x00, 0x00, 0xcf, 0xfe, 0x88, 0xef, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xff, 0xff, 0xff,
+  0xe2, 0x00, 0x00, 0x00, 0x00, 0x02, 0xbf, 0xff, 0xfb, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x66, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+  0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xbf, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3d, 0xff, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0xef, 0xff, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xdf, 0xff, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xef, 0xfb, 0x1f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x8e, 0x80, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f,
+  0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xfd, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x72, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x8c, 0xee, 0xc8, 0x20, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xff, 0xff, 0xf8, 0x00,
+  0x00, 0x00, 0x0a, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x00, 0x6f, 0xff, 0xa3, 0x00, 0x3a, 0xff, 0xf6, 0x00, 0x00,
+  0xef, 0xf7, 0x00, 0x00, 0x00, 0x7f, 0xfe, 0x00, 0x01, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x0c, 0xff, 0x40, 0x00, 0x48, 0x20,
+  0x00, 0x00, 0x00, 0x08, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x0c, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff,
+  0xf6, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf, 0xfc, 0x10, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x09, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x03, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1d, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xbf,
+  0xfd, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xff, 0x60, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xef, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1c, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xaf, 0xff, 0x98, 0x88, 0x88, 0x88, 0x87, 0x20, 0x05, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x05,
+  0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xd0, 0x00, 0x58, 0x88, 0x88, 0x88, 0x88, 0x88, 0x87, 0x20, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x48, 0xaa, 0x84, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x2c, 0xff, 0xff, 0xff, 0xc2, 0x00, 0x00, 0x00, 0x03, 0xef, 0xff, 0xff, 0xff, 0xfe, 0x30, 0x00, 0x00, 0x0d,
+  0xff, 0xe7, 0x44, 0x7e, 0xff, 0xd0, 0x00, 0x00, 0x3f, 0xfd, 0x20, 0x00, 0x02, 0xdf, 0xf7, 0x00, 0x00, 0x09, 0xc3, 0x00,
+  0x00, 0x00, 0x4f, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x0f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xdf, 0xf7,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x24, 0x7e, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xff, 0xfe, 0x30, 0x00, 0x00,
+  0x00, 0x00, 0x06, 0xff, 0xff, 0xfc, 0x20, 0x00, 0x00, 0x00, 0x00, 0x01, 0x9b, 0xef, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0xef, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04,
+  0xff, 0xa0, 0x00, 0x28, 0x40, 0x00, 0x00, 0x00, 0x08, 0xff, 0x80, 0x00, 0xcf, 0xe2, 0x00, 0x00, 0x00, 0x2e, 0xff, 0x30,
+  0x00, 0xbf, 0xfe, 0x50, 0x00, 0x05, 0xef, 0xfb, 0x00, 0x00, 0x1e, 0xff, 0xfe, 0xbb, 0xef, 0xff, 0xe1, 0x00, 0x00, 0x02,
+  0xcf, 0xff, 0xff, 0xff, 0xfc, 0x20, 0x00, 0x00, 0x00, 0x06, 0xcf, 0xff, 0xfc, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+  0x33, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x02, 0xdd, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0x70, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x6f, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xef, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c,
+  0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x02, 0xff, 0xfd, 0xff,
+  0x80, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xa8, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x8f, 0xfe, 0x18, 0xff, 0x80, 0x00,
+  0x00, 0x00, 0x03, 0xff, 0xf5, 0x08, 0xff, 0x80, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xa0, 0x08, 0xff, 0x80, 0x00, 0x00, 0x00,
+  0x8f, 0xfd, 0x10, 0x08, 0xff, 0x80, 0x00, 0x00, 0x03, 0xff, 0xf4, 0x00, 0x08, 0xff, 0x80, 0x00, 0x00, 0x0d, 0xff, 0x90,
+  0x00, 0x08, 0xff, 0x80, 0x00, 0x00, 0x8f, 0xfd, 0x10, 0x00, 0x08, 0xff, 0x80, 0x00, 0x04, 0xff, 0xfb, 0x88, 0x88, 0x8b,
+  0xff, 0xb8, 0x50, 0x0d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf5, 0x0d, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xf5, 0x02, 0x78, 0x88, 0x88, 0x88, 0x8b, 0xff, 0xb8, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x80, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x08, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x05, 0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x07, 0xff, 0xff,
+  0xff, 0xff, 0xff, 0xfe, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x0a, 0xff, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x0e, 0xff, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0f, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x2f, 0xfc, 0x01, 0x33, 0x10, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xfd, 0xbf, 0xff, 0xfb, 0x40, 0x00, 0x00, 0x00, 0x5f, 0xff,
+  0xff, 0xff, 0xff, 0xfa, 0x00, 0x00, 0x00, 0x6f, 0xff, 0xfe, 0xbb, 0xef, 0xff, 0xa0, 0x00, 0x00, 0x5f, 0xfd, 0x80, 0x00,
+  0x08, 0xff, 0xf6, 0x00, 0x00, 0x05, 0x50, 0x00, 0x00, 0x00, 0x6f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b,
+  0xff, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xa0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x04, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0xff, 0x80, 0x00, 0x00,
+  0x10, 0x00, 0x00, 0x00, 0x0c, 0xff, 0x50, 0x00, 0x1d, 0xf6, 0x00, 0x00, 0x00, 0x6f, 0xfe, 0x00, 0x00, 0x3f, 0xff, 0x80,
+  0x00, 0x08, 0xff, 0xf7, 0x00, 0x00, 0x0a, 0xff, 0xfe, 0xbb, 0xef, 0xff, 0xa0, 0x00, 0x00, 0x00, 0xaf, 0xff, 0xff, 0xff,
+  0xfa, 0x00, 0x00, 0x00, 0x00, 0x04, 0xbf, 0xff, 0xfb, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x22, 0x10, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4a, 0xee,
+  0xa4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08, 0xff, 0xff, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xff, 0xff, 0xff, 0xf7,
+  0x00, 0x00, 0x00, 0x03, 0xff, 0xf9, 0x11, 0x9f, 0xff, 0x20, 0x00, 0x00, 0x0b, 0xff, 0xa0, 0x00, 0x0a, 0xff, 0x30, 0x00,
+  0x00, 0x2f, 0xfe, 0x10, 0x00, 0x01, 0x86, 0x00, 0x00, 0x00, 0x8f, 0xf9, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xcf,
+  0xf3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xe0, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xb4, 0xbf,
+  0xff, 0xfb, 0x40, 0x00, 0x00, 0x05, 0xff, 0xef, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x06, 0xff, 0xff, 0xff, 0xbb, 0xff,
+  0xff, 0x80, 0x00, 0x07, 0xff, 0xff, 0x91, 0x00, 0x19, 0xff, 0xf3, 0x00, 0x06, 0xff, 0xf9, 0x00, 0x00, 0x00, 0x9f, 0xfb,
+  0x00, 0x06, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x1e, 0xff, 0x10, 0x05, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x0a, 0xff, 0x50, 0x06,
+  0xff, 0xb0, 0x00, 0x00, 0x00, 0x08, 0xff, 0x60, 0x06, 0xff, 0x80, 0x00, 0x00, 0x00, 0x08, 0xff, 0x60, 0x05, 0xff, 0xa0,
+  0x00, 0x00, 0x00, 0x0a, 0xff, 0x50, 0x01, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x1e, 0xff, 0x10, 0x00, 0xbf, 0xf9, 0x00, 0x00,
+  0x00, 0x9f, 0xfb, 0x00, 0x00, 0x3f, 0xff, 0x91, 0x00, 0x19, 0xff, 0xf3, 0x00, 0x00, 0x08, 0xff, 0xff, 0xbb, 0xff, 0xff,
+  0x80, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x04, 0xbf, 0xff, 0xfb, 0x40, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x22, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0x80, 0x07, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff,
+  0xe0, 0x02, 0xdf, 0xff, 0xff, 0xff, 0xff, 0xff, 0xff, 0xa0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0x50, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xfe, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xf9, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0xcf, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x08, 0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0d, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x4f, 0xfd,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x9f, 0xf7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xef, 0xf2, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x05, 0xff, 0xb0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0a, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1f, 0xff, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xfb, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0xbf, 0xf5, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xa0,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0x40, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2f, 0xfe, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x8f, 0xf8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xdf, 0xf3, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0xdf, 0xd0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x27, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0xaa, 0x83, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x1b, 0xff, 0xff, 0xff, 0xb1, 0x00, 0x00, 0x00, 0x01, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x00, 0x00, 0x0b,
+  0xff, 0xf8, 0x44, 0x8f, 0xff, 0xb0, 0x00, 0x00, 0x3f, 0xff, 0x40, 0x00, 0x04, 0xff, 0xf3, 0x00, 0x00, 0x8f, 0xf8, 0x00,
+  0x00, 0x00, 0x8f, 0xf8, 0x00, 0x00, 0xaf, 0xf4, 0x00, 0x00, 0x00, 0x4f, 0xfa, 0x00, 0x00, 0xaf, 0xf4, 0x00, 0x00, 0x00,
+  0x4f, 0xfa, 0x00, 0x00, 0x8f, 0xf8, 0x00, 0x00, 0x00, 0x8f, 0xf8, 0x00, 0x00, 0x3f, 0xff, 0x40, 0x00, 0x04, 0xff, 0xf3,
+  0x00, 0x00, 0x0b, 0xff, 0xf8, 0x66, 0x8f, 0xff, 0xb0, 0x00, 0x00, 0x01, 0xdf, 0xff, 0xff, 0xff, 0xfd, 0x10, 0x00, 0x00,
+  0x04, 0xef, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x00, 0x00, 0x3e, 0xff, 0xfb, 0xaa, 0xbf, 0xff, 0xe3, 0x00, 0x00, 0xcf, 0xfd,
+  0x20, 0x00, 0x02, 0xdf, 0xfc, 0x00, 0x04, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x1e, 0xff, 0x40, 0x08, 0xff, 0x70, 0x00, 0x00,
+  0x00, 0x07, 0xff, 0x80, 0x0a, 0xff, 0x40, 0x00, 0x00, 0x00, 0x04, 0xff, 0xa0, 0x0a, 0xff, 0x40, 0x00, 0x00, 0x00, 0x04,
+  0xff, 0xa0, 0x08, 0xff, 0x70, 0x00, 0x00, 0x00, 0x07, 0xff, 0x80, 0x04, 0xff, 0xe1, 0x00, 0x00, 0x00, 0x1e, 0xff, 0x40,
+  0x00, 0xcf, 0xfd, 0x20, 0x00, 0x02, 0xdf, 0xfc, 0x00, 0x00, 0x3e, 0xff, 0xfb, 0x88, 0xbf, 0xff, 0xe3, 0x00, 0x00, 0x04,
+  0xef, 0xff, 0xff, 0xff, 0xfe, 0x40, 0x00, 0x00, 0x00, 0x29, 0xff, 0xff, 0xff, 0x92, 0x00, 0x00, 0x00, 0x00, 0x00, 0x14,
+  0x66, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x38, 0xaa, 0x83, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2b, 0xff, 0xff, 0xff, 0xb2, 0x00, 0x00, 0x00, 0x02, 0xef,
+  0xff, 0xff, 0xff, 0xfe, 0x20, 0x00, 0x00, 0x0d, 0xff, 0xe8, 0x44, 0x8e, 0xff, 0xd0, 0x00, 0x00, 0x8f, 0xfe, 0x20, 0x00,
+  0x02, 0xef, 0xf8, 0x00, 0x00, 0xef, 0xf4, 0x00, 0x00, 0x00, 0x4f, 0xfe, 0x00, 0x03, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x0c,
+  0xff, 0x30, 0x06, 0xff, 0x80, 0x00, 0x00, 0x00, 0x08, 0xff, 0x60, 0x07, 0xff, 0x80, 0x00, 0x00, 0x00, 0x0a, 0xff, 0x70,
+  0x06, 0xff, 0x80, 0x00, 0x00, 0x00, 0x0b, 0xff, 0x60, 0x03, 0xff, 0xc0, 0x00, 0x00, 0x00, 0x0c, 0xff, 0x50, 0x00, 0xef,
+  0xf4, 0x00, 0x00, 0x00, 0x4f, 0xff, 0x60, 0x00, 0x8f, 0xfe, 0x20, 0x00, 0x02, 0xef, 0xff, 0x70, 0x00, 0x0d, 0xff, 0xe8,
+  0x44, 0x8e, 0xff, 0xff, 0x60, 0x00, 0x02, 0xef, 0xff, 0xff, 0xff, 0xff, 0xff, 0x60, 0x00, 0x00, 0x2b, 0xff, 0xff, 0xff,
+  0xbb, 0xff, 0x40, 0x00, 0x00, 0x00, 0x38, 0xaa, 0x83, 0x0c, 0xff, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1f, 0xfe,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6f, 0xfa, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0xcf, 0xf5, 0x00, 0x00,
+  0x01, 0xdf, 0x40, 0x00, 0x05, 0xff, 0xe0, 0x00, 0x00, 0x04, 0xff, 0xe2, 0x00, 0x2e, 0xff, 0x70, 0x00, 0x00, 0x00, 0xcf,
+  0xfe, 0x88, 0xef, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x2e, 0xff, 0xff, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x02, 0xbf, 0xff,
+  0xfb, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x66, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x08, 0xe8, 0x00, 0x00, 0x00, 0x0e, 0xfe, 0x00, 0x00, 0x00, 0x08, 0xe8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x05, 0x88, 0x88, 0x88, 0x85, 0x00, 0x5f, 0xff, 0xff, 0xff, 0xff, 0x50, 0x5f, 0xff, 0xff, 0xff, 0xff, 0x50,
+  0x05, 0x88, 0x88, 0x88, 0x85, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xa6, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x02, 0xdd, 0x20, 0x00, 0x00, 0x00, 0x2d, 0xff, 0xff, 0xd2, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0x70,
+  0x00, 0x00, 0x00, 0xdf, 0xff, 0xff, 0xfd, 0x00, 0x00, 0x00, 0x00, 0x7f, 0xfe, 0x20, 0x00, 0x00, 0x07, 0xff, 0xe5, 0x5e,
+  0xff, 0x70, 0x00, 0x00, 0x03, 0xff, 0xf5, 0x00, 0x00, 0x00, 0x0b, 0xff, 0x50, 0x05, 0xff, 0xb0, 0x00, 0x00, 0x1d, 0xff,
+  0xa0, 0x00, 0x00, 0x00, 0x0e, 0xff, 0x00, 0x00, 0xff, 0xe0, 0x00, 0x00, 0x9f, 0xfd, 0x10, 0x00, 0x00, 0x00, 0x0e, 0xff,
+  0x00, 0x00, 0xff, 0xe0, 0x00, 0x05, 0xff, 0xf4, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0x50, 0x05, 0xff, 0xb0, 0x00, 0x2e,
+  0xff, 0x80, 0x00, 0x00, 0x00, 0x00, 0x07, 0xff, 0xe5, 0x5e, 0xff, 0x70, 0x00, 0xbf, 0xfc, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0xdf, 0xff, 0xff, 0xfd, 0x00, 0x07, 0xff, 0xe2, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x2d, 0xff, 0xff, 0xd2, 0x00,
+  0x3f, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x6a, 0xa6, 0x00, 0x01, 0xdf, 0xfa, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x09, 0xff, 0xd1, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x5f, 0xff, 0x40, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xef, 0xf8, 0x00, 0x06, 0xef,
+  0xfe, 0x60, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0b, 0xff, 0xc0, 0x00, 0x8f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x7f, 0xfe, 0x20, 0x03, 0xff, 0xfd, 0xdf, 0xff, 0x30, 0x00, 0x00, 0x00, 0x00, 0x03, 0xff, 0xf6, 0x00, 0x09,
+  0xff, 0x90, 0x09, 0xff, 0x90, 0x00, 0x00, 0x00, 0x00, 0x0c, 0xff, 0xa0, 0x00, 0x0d, 0xff, 0x20, 0x02, 0xff, 0xd0, 0x00,
+  0x00, 0x00, 0x00, 0x9f, 0xfd, 0x10, 0x00, 0x0e, 0xff, 0x00, 0x00, 0xff, 0xe0, 0x00, 0x00, 0x00, 0x04, 0xff, 0xf4, 0x00,
+  0x00, 0x0d, 0xff, 0x20, 0x02, 0xff, 0xd0, 0x00, 0x00, 0x00, 0x1e, 0xff, 0x80, 0x00, 0x00, 0x09, 0xff, 0x90, 0x09, 0xff,
+  0x90, 0x00, 0x00, 0x00, 0xbf, 0xfc, 0x00, 0x00, 0x00, 0x03, 0xff, 0xfd, 0xdf, 0xff, 0x30, 0x00, 0x00, 0x05, 0xff, 0xf3,
+  0x00, 0x00, 0x00, 0x00, 0x8f, 0xff, 0xff, 0xf8, 0x00, 0x00, 0x00, 0x05, 0xff, 0x60, 0x00, 0x00, 0x00, 0x00, 0x06, 0xef,
+  0xfe, 0x60, 0x00, 0x00, 0x00, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x20, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0xdd,
+  0x22, 0xdd, 0x20, 0x00, 0x07, 0xff, 0x77, 0xff, 0x70, 0x00, 0x08, 0xff, 0x88, 0xff, 0x80, 0x00, 0x08, 0xff, 0x88, 0xff,
+  0x80, 0x00, 0x08, 0xff, 0x88, 0xff, 0x80, 0x00, 0x08, 0xff, 0x88, 0xff, 0x80, 0x00, 0x08, 0xff, 0x88, 0xff, 0x80, 0x00,
+  0x05, 0xff, 0x55, 0xff, 0x50, 0x00, 0x00, 0x55, 0x00, 0x55, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00
+};
+
+const GlyphInfo glyph_info[GLYPH_COUNT] = {
+  {'0', 18, 0},
+  {'1', 18, 288},
+  {'2', 18, 576},
+  {'3', 18, 864},
+  {'4', 18, 1152},
+  {'5', 18, 1440},
+  {'6', 18, 1728},
+  {'7', 18, 2016},
+  {'8', 18, 2304},
+  {'9', 18, 2592},
+  {'.', 9, 2880},
+  {'-', 11, 3040},
+  {'%', 27, 3232},
+  {'\"', 11, 3680},
+  {' ', 9, 3872},
+};
+
+#endif
@@ -41,7 +41,7 @@ extern WebServer webServer;
 bool writeConf() {
 
   if (!conf.begin("config", false)) {
-    setError("Preferences Failure");
+    raiseError("Preferences Failure", ERROR_CRITICAL);
     return false;
   }
 
@@ -21,29 +21,18 @@
 
 #include <WiFi.h> 
 #include "PubSubClient.h"
-#include "Ticker.h"
 #include "ecoconsole.h"
 
 WiFiClient espClient;
 PubSubClient mqttClient(espClient);
 char subName[25];
 
-void dataDoneCallback(void);
-Ticker dataDone(dataDoneCallback,2000); 
-
 extern String MQTT_SERVER;
 extern String MQTT_TOPIC;
 extern uint16_t MQTT_PORT;
 
-void dataDoneCallback() {
-    dataDone.stop();
-    drawAll();
-}
-
+// setData() hands the changed panels to the display's frame scheduler
 void mqttCallback(char *topic, byte *payload, uint16_t length) {
-    dataDone.stop();
-    dataDone.start();
-
     char *token=token=strtok(topic,"/");
     char *prevToken=NULL;
     while(token!=NULL) {
@@ -94,7 +83,6 @@ void initMQTT() {
 void mqttLoop(void) {
     if(!mqttClient.connected())
         reconnect();
-    
-    dataDone.update();
+
     mqttClient.loop();
 }
\ No newline at end of file
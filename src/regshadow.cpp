@@ -0,0 +1,164 @@
+/**
+ *  @filename   :   regshadow.cpp
+ *  @brief      :   ESP32 Ecowitt Weather Station Console, RA8875 register shadow module
+ *
+ *  @author     :   Kevin Kessler
+ *
+ * Copyright (C) 2024 Kevin Kessler
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <Arduino.h>
+#include <SPI.h>
+#include "Adafruit_RA8875.h"
+#include "regshadow.h"
+
+static Adafruit_RA8875 *shadowTft = NULL;
+static uint8_t shadowCs;
+static uint8_t shadowValue[256];
+static uint32_t shadowValid[8];
+static ShadowStats shadowStats;
+
+static inline bool isKnown(uint8_t reg) {
+  return (shadowValid[reg>>5] & (1UL << (reg & 0x1f))) != 0;
+}
+
+void shadowInit(Adafruit_RA8875 *tft, uint8_t cs) {
+  shadowTft = tft;
+  shadowCs = cs;
+  shadowInvalidateAll();
+  memset(&shadowStats, 0, sizeof(shadowStats));
+}
+
+bool shadowNeedsWrite(uint8_t reg, uint8_t val) {
+  if(isKnown(reg) && (shadowValue[reg] == val)) {
+    shadowStats.skipped++;
+    return false;
+  }
+
+  shadowStats.issued++;
+  return true;
+}
+
+void shadowRecord(uint8_t reg, uint8_t val) {
+  shadowValue[reg] = val;
+  shadowValid[reg>>5] |= (1UL << (reg & 0x1f));
+}
+
+void shadowWriteReg(uint8_t reg, uint8_t val) {
+  if(!shadowNeedsWrite(reg, val))
+    return;
+
+  shadowTft->writeReg(reg, val);
+  shadowRecord(reg, val);
+}
+
+void shadowForceWriteReg(uint8_t reg, uint8_t val) {
+  shadowStats.issued++;
+  shadowTft->writeReg(reg, val);
+  shadowRecord(reg, val);
+}
+
+// For start bits like BTE enable that the controller clears itself when done
+void shadowTriggerReg(uint8_t reg, uint8_t val, uint8_t selfClearing) {
+  shadowForceWriteReg(reg, val);
+  shadowRecord(reg, val & ~selfClearing);
+}
+
+uint8_t shadowReadReg(uint8_t reg) {
+  if(isKnown(reg)) {
+    shadowStats.readsServed++;
+    return shadowValue[reg];
+  }
+
+  shadowStats.readsIssued++;
+  uint8_t val = shadowTft->readReg(reg);
+  shadowRecord(reg, val);
+  return val;
+}
+
+void shadowInvalidate(uint8_t reg) {
+  shadowValid[reg>>5] &= ~(1UL << (reg & 0x1f));
+}
+
+void shadowInvalidateAll() {
+  memset(shadowValid, 0, sizeof(shadowValid));
+}
+
+const ShadowStats *getShadowStats() {
+  return &shadowStats;
+}
+
+void batchBegin(RegBatch *b) {
+  b->count = 0;
+}
+
+static void batchAdd(RegBatch *b, uint8_t reg, uint8_t val, uint8_t flags) {
+  if(b->count == REG_BATCH_MAX)
+    batchFlush(b);
+
+  b->reg[b->count] = reg;
+  b->val[b->count] = val;
+  b->flags[b->count] = flags;
+  b->count++;
+}
+
+void batchWrite(RegBatch *b, uint8_t reg, uint8_t val) {
+  if(!shadowNeedsWrite(reg, val))
+    return;
+
+  shadowRecord(reg, val);
+  batchAdd(b, reg, val, 0);
+}
+
+void batchForceWrite(RegBatch *b, uint8_t reg, uint8_t val) {
+  shadowStats.issued++;
+  shadowRecord(reg, val);
+  batchAdd(b, reg, val, 0);
+}
+
+void batchTrigger(RegBatch *b, uint8_t reg, uint8_t val, uint8_t selfClearing) {
+  batchForceWrite(b, reg, val);
+  shadowRecord(reg, val & ~selfClearing);
+}
+
+void batchCommand(RegBatch *b, uint8_t cmd) {
+  batchAdd(b, cmd, 0, REG_BATCH_COMMAND);
+}
+
+void batchFlush(RegBatch *b) {
+  if(b->count == 0)
+    return;
+
+  SPI.beginTransaction(SPISettings(REG_SPI_CLOCK, MSBFIRST, SPI_MODE0));
+  for(uint8_t n=0;n<b->count;n++) {
+    digitalWrite(shadowCs,LOW);
+    SPI.transfer(RA8875_CMDWRITE);
+    SPI.transfer(b->reg[n]);
+    digitalWrite(shadowCs,HIGH);
+
+    if(b->flags[n] & REG_BATCH_COMMAND)
+      continue;
+
+    digitalWrite(shadowCs,LOW);
+    SPI.transfer(RA8875_DATAWRITE);
+    SPI.transfer(b->val[n]);
+    digitalWrite(shadowCs,HIGH);
+  }
+  SPI.endTransaction();
+
+  b->count = 0;
+}
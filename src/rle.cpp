@@ -0,0 +1,98 @@
+/**
+ *  @filename   :   rle.cpp
+ *  @brief      :   ESP32 Ecowitt Weather Station Console, run length encoded image module
+ *
+ *  @author     :   Kevin Kessler
+ *
+ * Copyright (C) 2024 Kevin Kessler
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <Arduino.h>
+#include <SPI.h>
+#include "rle.h"
+
+#define RLE_CHUNK_PIXELS 64
+
+static void nextPacket(RleCursor *c) {
+  uint8_t header = *c->p++;
+
+  c->remaining = (header & 0x7f) + 1;
+  c->run = (header & RLE_RUN) != 0;
+  if(c->run) {
+    c->pixel[0] = *c->p++;
+    c->pixel[1] = *c->p++;
+  }
+}
+
+void rleSeek(RleCursor *c, const RleImage *img, uint16_t x, uint16_t y) {
+  c->p = &img->data[img->rowOffsets[y]];
+  c->remaining = 0;
+
+  while(true) {
+    nextPacket(c);
+    if(x < c->remaining)
+      break;
+
+    x -= c->remaining;
+    if(!c->run)
+      c->p += c->remaining * 2;
+  }
+
+  c->remaining -= x;
+  if(!c->run)
+    c->p += x * 2;
+}
+
+void rleRead(RleCursor *c, uint8_t *dst, uint16_t pixels) {
+  while(pixels > 0) {
+    if(c->remaining == 0)
+      nextPacket(c);
+
+    uint16_t n = min((uint16_t)c->remaining, pixels);
+    if(c->run) {
+      for(uint16_t i=0;i<n;i++) {
+        *dst++ = c->pixel[0];
+        *dst++ = c->pixel[1];
+      }
+    } else {
+      memcpy(dst, c->p, n*2);
+      dst += n*2;
+      c->p += n*2;
+    }
+
+    c->remaining -= n;
+    pixels -= n;
+  }
+}
+
+// Decode straight into the SPI FIFO, the caller has already opened the memory write
+void rleStreamRect(const RleImage *img, uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+  uint8_t chunk[RLE_CHUNK_PIXELS*2];
+  RleCursor c;
+
+  for(uint16_t row=0;row<h;row++) {
+    rleSeek(&c, img, x, y+row);
+
+    uint16_t left = w;
+    while(left > 0) {
+      uint16_t n = min(left, (uint16_t)RLE_CHUNK_PIXELS);
+      rleRead(&c, chunk, n);
+      SPI.writeBytes(chunk, n*2);
+      left -= n;
+    }
+  }
+}
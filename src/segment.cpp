@@ -0,0 +1,285 @@
+/**
+ *  @filename   :   segment.cpp
+ *  @brief      :   ESP32 Ecowitt Weather Station Console, seven segment value renderer
+ *
+ *  @author     :   Kevin Kessler
+ *
+ * Copyright (C) 2024 Kevin Kessler
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ */
+
+#include <Arduino.h>
+#include "Adafruit_RA8875.h"
+#include "display.h"
+#include "segment.h"
+
+#define SEG_COLOR RA8875_WHITE
+#define SEG_MAX_ERASED 24
+#define SEG_CELL_HEIGHT VALUE_CELL_HEIGHT
+#define SEG_SCALE(v) ((v)*SEG_CELL_HEIGHT/64)   // Shapes and advances are for a 64 pixel cell
+#define SEG_RADIUS SEG_SCALE(3)
+
+#define SEG_ROUND 0
+#define SEG_SLASH 1
+
+// Cell relative bounds in a 64 pixel cell.  The segments of a digit never overlap, so erasing one cannot
+// touch its neighbours.
+struct SegmentShape {
+  uint8_t x;
+  uint8_t y;
+  uint8_t w;
+  uint8_t h;
+  uint8_t kind;
+};
+
+static const SegmentShape shapes[] = {
+  {11,  9, 14,  6, SEG_ROUND},  // a
+  {26,  9,  6, 22, SEG_ROUND},  // b
+  {26, 32,  6, 22, SEG_ROUND},  // c
+  {11, 48, 14,  6, SEG_ROUND},  // d
+  { 4, 32,  6, 22, SEG_ROUND},  // e
+  { 4,  9,  6, 22, SEG_ROUND},  // f
+  {11, 28, 14,  6, SEG_ROUND},  // g
+  { 6, 48,  6,  6, SEG_ROUND},  // Decimal point
+  { 3, 28, 16,  6, SEG_ROUND},  // Minus
+  { 5,  9,  4, 11, SEG_ROUND},  // Inch marks
+  {13,  9,  4, 11, SEG_ROUND},
+  { 4,  9, 10, 10, SEG_ROUND},  // Percent
+  {26, 44, 10, 10, SEG_ROUND},
+  { 4,  9, 32, 45, SEG_SLASH}
+};
+
+#define SEG_SHAPES (sizeof(shapes)/sizeof(shapes[0]))
+
+struct SegmentChar {
+  char c;
+  uint8_t advance;
+  uint16_t mask;
+};
+
+static const SegmentChar chars[] = {
+  {'0', 36, 0x003f},
+  {'1', 36, 0x0006},
+  {'2', 36, 0x005b},
+  {'3', 36, 0x004f},
+  {'4', 36, 0x0066},
+  {'5', 36, 0x006d},
+  {'6', 36, 0x007d},
+  {'7', 36, 0x0007},
+  {'8', 36, 0x007f},
+  {'9', 36, 0x006f},
+  {'.', 18, 0x0080},
+  {'-', 22, 0x0100},
+  {'"', 22, 0x0600},
+  {'%', 40, 0x3800},
+  {' ', 18, 0x0000}
+};
+
+struct SegmentField {
+  uint16_t x;
+  uint16_t y;
+  uint16_t textx;
+  uint16_t texty;
+  bool used;
+  bool forced;            // Something restored part of the box, every lit segment goes again
+  char text[SEG_MAX_TEXT];
+};
+
+struct SegmentRect {
+  int16_t x;
+  int16_t y;
+  int16_t w;
+  int16_t h;
+};
+
+static SegmentField fields[SEG_MAX_FIELDS];
+static bool erasing = false;
+
+static const SegmentChar *lookupChar(char c) {
+  for(uint8_t n=0;n<sizeof(chars)/sizeof(chars[0]);n++) {
+    if(chars[n].c == c)
+      return &chars[n];
+  }
+  return NULL;
+}
+
+static SegmentField *lookupField(uint16_t x, uint16_t y) {
+  SegmentField *slot = NULL;
+
+  for(uint8_t n=0;n<SEG_MAX_FIELDS;n++) {
+    if(fields[n].used && (fields[n].x == x) && (fields[n].y == y))
+      return &fields[n];
+    if(!fields[n].used && (slot == NULL))
+      slot = &fields[n];
+  }
+
+  if(slot == NULL) {
+    Serial.println("Segment fields full");
+    return NULL;
+  }
+
+  memset(slot, 0, sizeof(SegmentField));
+  slot->used = true;
+  slot->x = x;
+  slot->y = y;
+  return slot;
+}
+
+// Character at pixel offset cellx of the string, or NULL when no cell starts there
+static const SegmentChar *charAt(const char *s, int16_t cellx) {
+  int16_t pen = 0;
+
+  for(;*s;s++) {
+    const SegmentChar *sc = lookupChar(*s);
+    if(sc == NULL)
+      continue;
+    if(pen == cellx)
+      return sc;
+    if(pen > cellx)
+      break;
+    pen += SEG_SCALE(sc->advance);
+  }
+  return NULL;
+}
+
+static void shapeRect(int16_t cellx, int16_t celly, uint8_t shape, SegmentRect *r) {
+  r->x = cellx + SEG_SCALE(shapes[shape].x);
+  r->y = celly + SEG_SCALE(shapes[shape].y);
+  r->w = SEG_SCALE(shapes[shape].w);
+  r->h = SEG_SCALE(shapes[shape].h);
+}
+
+static bool overlaps(const SegmentRect *a, const SegmentRect *b) {
+  return (a->x < b->x + b->w) && (b->x < a->x + a->w) && (a->y < b->y + b->h) && (b->y < a->y + a->h);
+}
+
+static void fillShape(Adafruit_RA8875 *tft, const SegmentRect *r, uint8_t kind) {
+  if(kind == SEG_SLASH) {
+    int16_t x1 = r->x + r->w - 1;
+    int16_t y1 = r->y + r->h - 1;
+    tft->fillTriangle(x1 - SEG_SCALE(6), r->y, x1, r->y, r->x, y1, SEG_COLOR);
+    tft->fillTriangle(x1, r->y, r->x + SEG_SCALE(6), y1, r->x, y1, SEG_COLOR);
+  } else {
+    tft->fillRoundRect(r->x, r->y, r->w, r->h, SEG_RADIUS, SEG_COLOR);
+  }
+}
+
+void segmentDrawValue(Adafruit_RA8875 *tft, uint16_t x, uint16_t y, uint16_t w, uint16_t h, uint16_t textx, uint16_t texty, const char *s) {
+  SegmentField *f = lookupField(x, y);
+  SegmentRect erased[SEG_MAX_ERASED];
+  uint8_t erasedCount = 0;
+  bool eraseOverflow = false;
+  const char *prev = "";
+
+  if(f == NULL)
+    return;
+
+  if(f->text[0] && (f->textx == textx) && (f->texty == texty))
+    prev = f->text;
+
+  // A moved string shares no cells with the old one, erase it whole
+  if(f->text[0] && (prev != f->text)) {
+    erasing = true;
+    redrawBackgroundSection(x, y, w, h);
+    erasing = false;
+    f->forced = true;
+  }
+
+  // Segments that went out
+  erasing = true;
+  int16_t pen = textx;
+  for(const char *p=prev;*p;p++) {
+    const SegmentChar *oc = lookupChar(*p);
+    if(oc == NULL)
+      continue;
+
+    const SegmentChar *nc = charAt(s, pen - textx);
+    uint16_t off = oc->mask & ~(nc ? nc->mask : 0);
+
+    for(uint8_t n=0;n<SEG_SHAPES;n++) {
+      if(!(off & (1<<n)))
+        continue;
+
+      SegmentRect r;
+      shapeRect(pen, texty, n, &r);
+      redrawBackgroundSection(r.x, r.y, r.w, r.h);
+      if(erasedCount < SEG_MAX_ERASED)
+        erased[erasedCount++] = r;
+      else
+        eraseOverflow = true;
+    }
+    pen += SEG_SCALE(oc->advance);
+  }
+  erasing = false;
+
+  // Segments that came on, and any lit one an erase cut into
+  tft->graphicsMode();
+  pen = textx;
+  for(const char *p=s;*p;p++) {
+    const SegmentChar *nc = lookupChar(*p);
+    if(nc == NULL)
+      continue;
+
+    const SegmentChar *oc = charAt(prev, pen - textx);
+    uint16_t on = nc->mask;
+    if(!f->forced && !eraseOverflow)
+      on &= ~(oc ? oc->mask : 0);
+
+    for(uint8_t n=0;n<SEG_SHAPES;n++) {
+      if(!(nc->mask & (1<<n)))
+        continue;
+
+      SegmentRect r;
+      shapeRect(pen, texty, n, &r);
+      bool cut = false;
+      for(uint8_t e=0;(e<erasedCount)&&!cut;e++)
+        cut = overlaps(&r, &erased[e]);
+
+      if((on & (1<<n)) || cut)
+        fillShape(tft, &r, shapes[n].kind);
+    }
+    pen += SEG_SCALE(nc->advance);
+  }
+
+  f->textx = textx;
+  f->texty = texty;
+  f->forced = false;
+  strncpy(f->text, s, SEG_MAX_TEXT-1);
+  f->text[SEG_MAX_TEXT-1] = 0;
+}
+
+// A restore that reaches into a value box wipes whatever segments were lit there.  The
+// old string is kept so the next draw still erases what falls outside the restore.
+void segmentForget(uint16_t x, uint16_t y, uint16_t w, uint16_t h) {
+  if(erasing)
+    return;
+
+  SegmentRect r = {(int16_t)x, (int16_t)y, (int16_t)w, (int16_t)h};
+  for(uint8_t n=0;n<SEG_MAX_FIELDS;n++) {
+    if(!fields[n].used || !fields[n].text[0])
+      continue;
+
+    SegmentRect cells = {(int16_t)fields[n].textx, (int16_t)fields[n].texty, 0, SEG_CELL_HEIGHT};
+    const char *p;
+    for(p=fields[n].text;*p;p++) {
+      const SegmentChar *sc = lookupChar(*p);
+      if(sc)
+        cells.w += SEG_SCALE(sc->advance);
+    }
+    if(overlaps(&r, &cells))
+      fields[n].forced = true;
+  }
+}
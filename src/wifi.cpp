@@ -22,10 +22,23 @@
 
 #include <ElegantOTA.h>
 #include "ecoconsole.h"
+#include "display.h"
+#include "assetpack.h"
 
 WebServer webServer;
 
 const char *hostname="EcoConsole";
+
+#define SCREENSHOT_WIDTH SCREEN_WIDTH
+#define SCREENSHOT_HEIGHT SCREEN_HEIGHT
+#define BMP_HEADER_SIZE 66      // File header, BITMAPINFOHEADER and three colour masks
+
+static void putLE32(uint8_t *p, uint32_t v) {
+  p[0] = v & 0xff;
+  p[1] = (v>>8) & 0xff;
+  p[2] = (v>>16) & 0xff;
+  p[3] = v>>24;
+}
 extern String MQTT_SERVER;
 extern String INFLUX_SERVER;
 extern String INFLUX_TOKEN;
@@ -34,6 +47,8 @@ extern String SSID;
 extern String PASS;
 extern uint16_t MQTT_PORT;
 
+static bool assetUploadOk = false;
+
 bool initWiFi() {
   WiFi.mode(WIFI_AP_STA);
   WiFi.setHostname(hostname);
@@ -50,7 +65,7 @@ bool initWiFi() {
 
   if(WiFi.status()!=WL_CONNECTED) {
     WiFi.beginSmartConfig();
-    setError("Waiting for Smart Config");
+    raiseError("Waiting for Smart Config", ERROR_CRITICAL);
     for(int n=600; n && (!WiFi.smartConfigDone()); --n) {
       Serial.print("x");
       delay(500);
@@ -77,7 +92,7 @@ bool initWiFi() {
     return true;
   } else
 
-  setError("Failure Connecting WiFi");
+  raiseError("Failure Connecting WiFi", ERROR_CRITICAL);
   return false;
 }
 
@@ -93,6 +108,9 @@ void otaSetup() {
     message += "<a href=\"/update\">Upload Firmware</a></center>";
     message += "<center><a href=\"/resetwifi\">Reset Wifi Settings</a></center>";
     message += "<center><a href=\"/restart\">Restart ESP32</a></center>";
+    message += "<center><a href=\"/screenshot\">Screenshot</a></center>";
+    message += "<form method=\"POST\" action=\"/assets\" enctype=\"multipart/form-data\"><center>Asset Pack ";
+    message += "<input type=\"file\" name=\"pack\"><input type=\"submit\" value=\"Upload\"></form>";
 
     message += "<form action=\"/mqttserver\"><center>MQTT Server <input type=\"text\" name=\"mqttserver\" value=\"";
     message += MQTT_SERVER;
@@ -249,6 +267,78 @@ void otaSetup() {
         webServer.send(500,"text/plain","Error occured saving EEPROM or parameter name incorrect");
   });
 
+  // Asset pack from tools/assetgen.cpp --pack, written into the assets partition and mapped
+  // on the restart that follows
+  webServer.on("/assets", HTTP_POST, []() {
+    if(assetUploadOk) {
+      webServer.send(200,"text/plain","OK");
+      ESP.restart();
+    } else {
+      assetPackBegin();
+      selectBackground();
+      webServer.send(500,"text/plain","Asset pack upload failed");
+    }
+  }, []() {
+    HTTPUpload &upload = webServer.upload();
+
+    if(upload.status == UPLOAD_FILE_START) {
+      waitDisplayIdle();          // The upload task may be streaming the background
+      assetUploadOk = assetPackWriteBegin();
+      selectBackground();
+    } else if((upload.status == UPLOAD_FILE_WRITE) && assetUploadOk) {
+      assetUploadOk = assetPackWrite(upload.buf, upload.currentSize);
+    } else if((upload.status == UPLOAD_FILE_END) && assetUploadOk) {
+      assetUploadOk = assetPackWriteEnd();
+    } else if(upload.status == UPLOAD_FILE_ABORTED) {
+      assetUploadOk = false;
+    }
+  });
+
+  // The screen as a top down 16bpp BMP, read back and sent a row per chunk so memory use
+  // stays at one row.  MQTT and the display keep running between rows.
+  webServer.on("/screenshot", []() {
+    static uint8_t row[SCREENSHOT_WIDTH*2];
+    uint8_t header[BMP_HEADER_SIZE];
+    uint32_t imageSize = (uint32_t)SCREENSHOT_WIDTH*SCREENSHOT_HEIGHT*2;
+
+    memset(header, 0, sizeof(header));
+    header[0] = 'B';
+    header[1] = 'M';
+    putLE32(&header[2], BMP_HEADER_SIZE + imageSize);
+    putLE32(&header[10], BMP_HEADER_SIZE);                // Pixel data offset
+    putLE32(&header[14], 40);                             // BITMAPINFOHEADER
+    putLE32(&header[18], SCREENSHOT_WIDTH);
+    putLE32(&header[22], (uint32_t)-SCREENSHOT_HEIGHT);   // Negative, rows run top down
+    header[26] = 1;                                       // Planes
+    header[28] = 16;                                      // Bits per pixel
+    putLE32(&header[30], 3);                              // BI_BITFIELDS
+    putLE32(&header[34], imageSize);
+    putLE32(&header[54], 0xf800);                         // RGB565 masks
+    putLE32(&header[58], 0x07e0);
+    putLE32(&header[62], 0x001f);
+
+    webServer.setContentLength(CONTENT_LENGTH_UNKNOWN);
+    webServer.send(200,"image/bmp","");
+    webServer.sendContent((const char *)header, sizeof(header));
+
+    for(uint16_t y=0;y<SCREENSHOT_HEIGHT;y++) {
+      readScreenRow(y, row);
+      for(uint16_t x=0;x<SCREENSHOT_WIDTH;x++) {     // BMP pixels are little endian
+        uint8_t hi = row[x*2];
+        row[x*2] = row[x*2+1];
+        row[x*2+1] = hi;
+      }
+
+      if(!webServer.client().connected())
+        break;
+      webServer.sendContent((const char *)row, sizeof(row));
+
+      displayLoop();
+      mqttLoop();
+    }
+    webServer.sendContent("");
+  });
+
   ElegantOTA.begin(&webServer);
   webServer.begin();
 } 
\ No newline at end of file
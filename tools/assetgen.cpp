@@ -0,0 +1,1081 @@
+/**
+ *  @filename   :   assetgen.cpp
+ *  @brief      :   ESP32 Ecowitt Weather Station Console, host tool converting PNG assets
+ *
+ *  @author     :   Kevin Kessler
+ *
+ * Copyright (C) 2024 Kevin Kessler
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Build on the host:  c++ -O2 -o assetgen tools/assetgen.cpp
+ *  Usage:              assetgen <assets.txt> <out.cpp> <out.h>
+ *                      assetgen --pack <assets.txt> <out.bin>
+ *
+ *  Run by tools/assets.py before every PlatformIO build.  Each line of the manifest names
+ *  a PNG, the symbol prefix and an encoding:
+ *    raw   RGB565 high byte first, <name>_bmp
+ *    rle   row indexed RLE (rle.h), <name>_rle
+ *    mono  one 1bpp colour expansion plane per colour (monoicon.h), <name>_mono
+ *    span  opaque rectangles only (spanbitmap.h), <name>_span
+ *    auto  whichever costs the fewest SPI bytes per draw, then the least flash
+ *  Every asset also gets an Asset handle <name>_asset that drawAsset() takes, so changing
+ *  the encoding needs no code change, and ASSET_<NAME>_WIDTH/HEIGHT/FORMAT defines.
+ *  Options after the encoding:
+ *    optional  skip the asset when its PNG is not in the tree
+ *    chrome    draw the panel borders and fixed labels of Layout.h into the image first
+ *              and flag it ASSET_FLAG_CHROME, for the screen sized background
+ *    tiles     also emit <name>_tiles, contiguous crops of the Layout.h layoutTiles
+ *              regions that restores of the screen sized background send in one burst
+ *    scaled    shrink an icon by the ICON_SCALE() of the layout, the 480x272 icons
+ *  Transparent pixels (alpha < 128) and white are the transparent colour 0xffff.  Only
+ *  8 bit, non interlaced PNGs are read.
+ *
+ *  With --pack the same assets are written as an asset pack (assetpack.h) for the assets
+ *  partition instead, upload it to http://<console>/assets to change theme without a
+ *  firmware update.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstdint>
+#include <cstring>
+#include <cctype>
+#include <cstdarg>
+#include <string>
+#include <vector>
+#include <map>
+#include <algorithm>
+#include "../include/Layout.h"
+
+#define TRANSPARENT 0xffff
+#define WINDOW_COST 28          // SPI bytes per BTE window, SPAN_WINDOW_COST in spanbitmap.h
+#define MAX_PLANES 4
+#define RLE_MAX_PACKET 128
+
+// Asset pack layout, see assetpack.h
+#define PACK_MAGIC 0x50414345    // "ECAP"
+#define PACK_VERSION 1
+#define PACK_HEADER_SIZE 16
+#define PACK_ENTRY_SIZE 32
+#define PACK_NAME_LEN 16
+
+#define FLAG_CHROME 0x01        // ASSET_FLAG_CHROME
+
+enum Format {RAW, RLE, MONO, SPAN, AUTO};
+static const char *formatNames[] = {"raw", "rle", "mono", "span", "auto"};
+static const char *formatTags[] = {"ASSET_RAW", "ASSET_RLE", "ASSET_MONO", "ASSET_SPAN"};
+static const char *formatSuffix[] = {"bmp", "rle", "mono", "span"};
+
+struct Image {
+  int width;
+  int height;
+  std::vector<uint16_t> px;
+};
+
+struct Rect {
+  int x;
+  int y;
+  int w;
+  int h;
+};
+
+struct Encoded {
+  bool possible;
+  size_t transfer;        // SPI bytes per draw
+  size_t flash;
+  std::string source;     // C definition of <name>_<suffix>
+  uint16_t count;         // Mono planes or span windows
+  std::vector<uint8_t> blob;  // Asset pack data
+};
+
+static void put16(std::vector<uint8_t> &v, uint32_t n) {
+  v.push_back(n & 0xff);
+  v.push_back((n >> 8) & 0xff);
+}
+
+static void put32(std::vector<uint8_t> &v, uint32_t n) {
+  put16(v, n & 0xffff);
+  put16(v, n >> 16);
+}
+
+static bool readFile(const std::string &name, std::vector<uint8_t> &out) {
+  FILE *f = fopen(name.c_str(), "rb");
+  if(f == NULL)
+    return false;
+
+  uint8_t buf[4096];
+  size_t n;
+  while((n = fread(buf, 1, sizeof(buf), f)) > 0)
+    out.insert(out.end(), buf, buf + n);
+
+  fclose(f);
+  return true;
+}
+
+static std::string format(const char *fmt, ...) __attribute__((format(printf, 1, 2)));
+static std::string format(const char *fmt, ...) {
+  char buf[512];
+  va_list ap;
+  va_start(ap, fmt);
+  vsnprintf(buf, sizeof(buf), fmt, ap);
+  va_end(ap);
+  return buf;
+}
+
+static std::string bytes(const std::vector<uint8_t> &data) {
+  std::string s;
+  for(size_t n = 0; n < data.size(); n++)
+    s += format("%s0x%02x", (n == 0) ? "\n  " : (n % 20) ? ", " : ",\n  ", data[n]);
+  return s;
+}
+
+/*
+ * Inflate, enough of RFC 1951 for PNG IDAT streams
+ */
+struct BitReader {
+  const uint8_t *p;
+  const uint8_t *end;
+  uint32_t bits;
+  int count;
+};
+
+static int getBits(BitReader *br, int n) {
+  while(br->count < n) {
+    if(br->p >= br->end)
+      return -1;
+    br->bits |= (uint32_t)(*br->p++) << br->count;
+    br->count += 8;
+  }
+  int v = br->bits & ((1 << n) - 1);
+  br->bits >>= n;
+  br->count -= n;
+  return v;
+}
+
+struct Huffman {
+  uint16_t counts[16];
+  uint16_t symbols[288];
+};
+
+static void buildHuffman(Huffman *h, const uint8_t *lengths, int n) {
+  uint16_t offs[16];
+  memset(h->counts, 0, sizeof(h->counts));
+  for(int i = 0; i < n; i++)
+    h->counts[lengths[i]]++;
+  h->counts[0] = 0;
+  offs[1] = 0;
+  for(int i = 1; i < 15; i++)
+    offs[i + 1] = offs[i] + h->counts[i];
+  for(int i = 0; i < n; i++)
+    if(lengths[i])
+      h->symbols[offs[lengths[i]]++] = i;
+}
+
+static int decodeSymbol(BitReader *br, const Huffman *h) {
+  int code = 0, first = 0, index = 0;
+  for(int len = 1; len < 16; len++) {
+    int bit = getBits(br, 1);
+    if(bit < 0)
+      return -1;
+    code |= bit;
+    int count = h->counts[len];
+    if(code - count < first)
+      return h->symbols[index + (code - first)];
+    index += count;
+    first = (first + count) << 1;
+    code <<= 1;
+  }
+  return -1;
+}
+
+static bool inflate(const std::vector<uint8_t> &in, std::vector<uint8_t> &out) {
+  static const uint16_t lenBase[] = {3,4,5,6,7,8,9,10,11,13,15,17,19,23,27,31,35,43,51,59,67,83,99,115,131,163,195,227,258};
+  static const uint8_t lenExtra[] = {0,0,0,0,0,0,0,0,1,1,1,1,2,2,2,2,3,3,3,3,4,4,4,4,5,5,5,5,0};
+  static const uint16_t distBase[] = {1,2,3,4,5,7,9,13,17,25,33,49,65,97,129,193,257,385,513,769,1025,1537,2049,3073,4097,6145,8193,12289,16385,24577};
+  static const uint8_t distExtra[] = {0,0,0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7,8,8,9,9,10,10,11,11,12,12,13,13};
+  static const uint8_t order[] = {16,17,18,0,8,7,9,6,10,5,11,4,12,3,13,2,14,1,15};
+
+  if(in.size() < 2)
+    return false;
+  BitReader br = {in.data() + 2, in.data() + in.size(), 0, 0};   // Skip the zlib header
+
+  int final;
+  do {
+    final = getBits(&br, 1);
+    int type = getBits(&br, 2);
+
+    if(type == 0) {
+      br.bits = 0;
+      br.count = 0;
+      if(br.end - br.p < 4)
+        return false;
+      int len = br.p[0] | (br.p[1] << 8);
+      br.p += 4;
+      if(br.end - br.p < len)
+        return false;
+      out.insert(out.end(), br.p, br.p + len);
+      br.p += len;
+      continue;
+    }
+
+    Huffman lit, dist;
+    uint8_t lengths[320];
+    if(type == 1) {
+      for(int i = 0; i < 144; i++) lengths[i] = 8;
+      for(int i = 144; i < 256; i++) lengths[i] = 9;
+      for(int i = 256; i < 280; i++) lengths[i] = 7;
+      for(int i = 280; i < 288; i++) lengths[i] = 8;
+      buildHuffman(&lit, lengths, 288);
+      for(int i = 0; i < 30; i++) lengths[i] = 5;
+      buildHuffman(&dist, lengths, 30);
+    } else if(type == 2) {
+      int nlen = getBits(&br, 5) + 257;
+      int ndist = getBits(&br, 5) + 1;
+      int ncode = getBits(&br, 4) + 4;
+      uint8_t codeLengths[19] = {0};
+      for(int i = 0; i < ncode; i++)
+        codeLengths[order[i]] = getBits(&br, 3);
+      Huffman code;
+      buildHuffman(&code, codeLengths, 19);
+
+      int n = 0;
+      while(n < nlen + ndist) {
+        int sym = decodeSymbol(&br, &code);
+        if(sym < 0)
+          return false;
+        if(sym < 16) {
+          lengths[n++] = sym;
+        } else {
+          int repeat, value = 0;
+          if(sym == 16) {
+            if(n == 0)
+              return false;
+            value = lengths[n - 1];
+            repeat = 3 + getBits(&br, 2);
+          } else if(sym == 17) {
+            repeat = 3 + getBits(&br, 3);
+          } else {
+            repeat = 11 + getBits(&br, 7);
+          }
+          if(n + repeat > nlen + ndist)
+            return false;
+          while(repeat--)
+            lengths[n++] = value;
+        }
+      }
+      buildHuffman(&lit, lengths, nlen);
+      buildHuffman(&dist, lengths + nlen, ndist);
+    } else {
+      return false;
+    }
+
+    for(;;) {
+      int sym = decodeSymbol(&br, &lit);
+      if(sym < 0)
+        return false;
+      if(sym < 256) {
+        out.push_back(sym);
+      } else if(sym == 256) {
+        break;
+      } else {
+        sym -= 257;
+        if(sym >= 29)
+          return false;
+        int len = lenBase[sym] + getBits(&br, lenExtra[sym]);
+        int d = decodeSymbol(&br, &dist);
+        if((d < 0) || (d >= 30))
+          return false;
+        size_t distance = distBase[d] + getBits(&br, distExtra[d]);
+        if(distance > out.size())
+          return false;
+        size_t from = out.size() - distance;
+        for(int i = 0; i < len; i++)
+          out.push_back(out[from + i]);
+      }
+    }
+  } while(!final);
+
+  return true;
+}
+
+static uint32_t be32(const uint8_t *p) {
+  return ((uint32_t)p[0] << 24) | (p[1] << 16) | (p[2] << 8) | p[3];
+}
+
+static int paeth(int a, int b, int c) {
+  int p = a + b - c;
+  int pa = abs(p - a), pb = abs(p - b), pc = abs(p - c);
+  if((pa <= pb) && (pa <= pc))
+    return a;
+  return (pb <= pc) ? b : c;
+}
+
+// 8 bit greyscale, RGB, palette, grey+alpha or RGBA, non interlaced
+static bool readPng(const std::string &name, Image *img, std::string *error) {
+  std::vector<uint8_t> file;
+  if(!readFile(name, file)) {
+    *error = "not found";
+    return false;
+  }
+  if((file.size() < 8) || (memcmp(file.data(), "\x89PNG\r\n\x1a\n", 8) != 0)) {
+    *error = "not a PNG";
+    return false;
+  }
+
+  std::vector<uint8_t> idat, palette, trns;
+  int depth = 0, colorType = 0, interlace = 0;
+  size_t pos = 8;
+  while(pos + 8 <= file.size()) {
+    uint32_t len = be32(&file[pos]);
+    std::string type((const char *)&file[pos + 4], 4);
+    if(pos + 12 + len > file.size())
+      break;
+    const uint8_t *data = &file[pos + 8];
+
+    if(type == "IHDR") {
+      img->width = be32(data);
+      img->height = be32(data + 4);
+      depth = data[8];
+      colorType = data[9];
+      interlace = data[12];
+    } else if(type == "PLTE") {
+      palette.assign(data, data + len);
+    } else if(type == "tRNS") {
+      trns.assign(data, data + len);
+    } else if(type == "IDAT") {
+      idat.insert(idat.end(), data, data + len);
+    } else if(type == "IEND") {
+      break;
+    }
+    pos += 12 + len;
+  }
+
+  static const int channelsFor[] = {1, 0, 3, 1, 2, 0, 4};
+  if((depth != 8) || interlace || (colorType > 6) || (channelsFor[colorType] == 0)) {
+    *error = "only 8 bit non interlaced PNGs are supported";
+    return false;
+  }
+  int channels = channelsFor[colorType];
+
+  std::vector<uint8_t> raw;
+  if(!inflate(idat, raw)) {
+    *error = "bad image data";
+    return false;
+  }
+
+  size_t stride = (size_t)img->width * channels;
+  if(raw.size() < (stride + 1) * img->height) {
+    *error = "short image data";
+    return false;
+  }
+
+  std::vector<uint8_t> prev(stride, 0), row(stride);
+  img->px.resize((size_t)img->width * img->height);
+  for(int y = 0; y < img->height; y++) {
+    const uint8_t *line = &raw[y * (stride + 1)];
+    int filter = line[0];
+    for(size_t i = 0; i < stride; i++) {
+      int a = (i >= (size_t)channels) ? row[i - channels] : 0;
+      int b = prev[i];
+      int c = (i >= (size_t)channels) ? prev[i - channels] : 0;
+      int x = line[i + 1];
+      switch(filter) {
+        case 1: x += a; break;
+        case 2: x += b; break;
+        case 3: x += (a + b) / 2; break;
+        case 4: x += paeth(a, b, c); break;
+        default: break;
+      }
+      row[i] = x & 0xff;
+    }
+
+    for(int x = 0; x < img->width; x++) {
+      const uint8_t *p = &row[x * channels];
+      int r, g, b, alpha = 255;
+      switch(colorType) {
+        case 0: r = g = b = p[0]; break;
+        case 2: r = p[0]; g = p[1]; b = p[2]; break;
+        case 3:
+          if((size_t)p[0] * 3 + 2 >= palette.size()) {
+            *error = "palette index out of range";
+            return false;
+          }
+          r = palette[p[0] * 3]; g = palette[p[0] * 3 + 1]; b = palette[p[0] * 3 + 2];
+          if(p[0] < trns.size())
+            alpha = trns[p[0]];
+          break;
+        case 4: r = g = b = p[0]; alpha = p[1]; break;
+        default: r = p[0]; g = p[1]; b = p[2]; alpha = p[3]; break;
+      }
+
+      img->px[y * img->width + x] = (alpha < 128) ? TRANSPARENT : ((r & 0xf8) << 8) | ((g & 0xfc) << 3) | (b >> 3);
+    }
+    prev = row;
+  }
+
+  return true;
+}
+
+// Box filter down to ICON_SCALE() of the size.  A pixel is transparent when most of its
+// box is, otherwise the average of the opaque pixels, so edges don't pick up a white halo.
+static void scaleImage(Image *img) {
+  Image out;
+  out.width = ICON_SCALE(img->width);
+  out.height = ICON_SCALE(img->height);
+  if((out.width == img->width) && (out.height == img->height))
+    return;
+
+  for(int y = 0; y < out.height; y++) {
+    int y0 = y * img->height / out.height;
+    int y1 = std::max(y0 + 1, (y + 1) * img->height / out.height);
+    for(int x = 0; x < out.width; x++) {
+      int x0 = x * img->width / out.width;
+      int x1 = std::max(x0 + 1, (x + 1) * img->width / out.width);
+      int opaque = 0, r = 0, g = 0, b = 0;
+      for(int sy = y0; sy < y1; sy++) {
+        for(int sx = x0; sx < x1; sx++) {
+          uint16_t c = img->px[sy * img->width + sx];
+          if(c == TRANSPARENT)
+            continue;
+          opaque++;
+          r += c >> 11;
+          g += (c >> 5) & 0x3f;
+          b += c & 0x1f;
+        }
+      }
+
+      if(opaque * 2 < (x1 - x0) * (y1 - y0))
+        out.px.push_back(TRANSPARENT);
+      else
+        out.px.push_back(((r / opaque) << 11) | ((g / opaque) << 5) | (b / opaque));
+    }
+  }
+  *img = out;
+}
+
+static std::vector<uint8_t> rgb565(const Image &img, int x0, int y0, int w, int h) {
+  std::vector<uint8_t> out;
+  for(int y = y0; y < y0 + h; y++) {
+    for(int x = x0; x < x0 + w; x++) {
+      out.push_back(img.px[y * img.width + x] >> 8);
+      out.push_back(img.px[y * img.width + x] & 0xff);
+    }
+  }
+  return out;
+}
+
+static Encoded encodeRaw(const Image &img, const std::string &sym) {
+  std::vector<uint8_t> data = rgb565(img, 0, 0, img.width, img.height);
+  Encoded e = {true, WINDOW_COST + data.size(), data.size(), "", 0, {}};
+  e.source = "const uint8_t " + sym + "[] = {" + bytes(data) + "\n};\n";
+  e.blob = data;
+  return e;
+}
+
+// Packet header 1nnnnnnn is a run of n+1 pixels, 0nnnnnnn n+1 literal pixels
+static void rleRow(const uint16_t *row, int width, std::vector<uint8_t> &out) {
+  int x = 0;
+
+  while(x < width) {
+    int run = 1;
+    while((x + run < width) && (run < RLE_MAX_PACKET) && (row[x + run] == row[x]))
+      run++;
+
+    if(run >= 2) {
+      out.push_back(0x80 | (run - 1));
+      out.push_back(row[x] >> 8);
+      out.push_back(row[x] & 0xff);
+      x += run;
+      continue;
+    }
+
+    // Literal packet, ends where the next run of two or more starts
+    int lit = 1;
+    while((x + lit < width) && (lit < RLE_MAX_PACKET)) {
+      if((x + lit + 1 < width) && (row[x + lit] == row[x + lit + 1]))
+        break;
+      lit++;
+    }
+
+    out.push_back(lit - 1);
+    for(int i = 0; i < lit; i++) {
+      out.push_back(row[x + i] >> 8);
+      out.push_back(row[x + i] & 0xff);
+    }
+    x += lit;
+  }
+}
+
+static Encoded encodeRle(const Image &img, const std::string &sym) {
+  std::vector<uint8_t> data;
+  std::vector<uint32_t> offsets;
+
+  for(int y = 0; y < img.height; y++) {
+    offsets.push_back(data.size());
+    rleRow(&img.px[y * img.width], img.width, data);
+  }
+
+  Encoded e = {true, WINDOW_COST + (size_t)img.width * img.height * 2, data.size() + offsets.size() * 4, "", 0, {}};
+  e.source = "static const uint32_t " + sym + "_rows[] = {";
+  for(size_t n = 0; n < offsets.size(); n++)
+    e.source += format("%s%u", (n == 0) ? "\n  " : (n % 12) ? ", " : ",\n  ", offsets[n]);
+  e.source += "\n};\n\nstatic const uint8_t " + sym + "_data[] = {" + bytes(data) + "\n};\n\n";
+  e.source += format("const RleImage %s = {%d, %d, %s_rows, %s_data};\n", sym.c_str(), img.width, img.height,
+    sym.c_str(), sym.c_str());
+
+  for(uint32_t offset : offsets)
+    put32(e.blob, offset);
+  e.blob.insert(e.blob.end(), data.begin(), data.end());
+  return e;
+}
+
+static Encoded encodeMono(const Image &img, const std::string &sym) {
+  Encoded e = {false, 0, 0, "", 0, {}};
+
+  // Planes in order of pixel count
+  std::map<uint16_t, int> counts;
+  for(uint16_t c : img.px)
+    if(c != TRANSPARENT)
+      counts[c]++;
+  std::vector<std::pair<int, uint16_t> > colors;
+  for(auto &c : counts)
+    colors.push_back(std::make_pair(-c.second, c.first));
+  std::sort(colors.begin(), colors.end());
+
+  if(colors.empty() || (colors.size() > MAX_PLANES))
+    return e;
+
+  // Pack blob is the plane colours padded to 4 bytes, then the planes
+  for(size_t p = 0; p < colors.size(); p++)
+    put16(e.blob, colors[p].second);
+  if(colors.size() & 1)
+    put16(e.blob, 0);
+  e.count = colors.size();
+
+  int stride = (img.width + 7) / 8;
+  for(size_t p = 0; p < colors.size(); p++) {
+    std::vector<uint8_t> plane(stride * img.height, 0);
+    for(int y = 0; y < img.height; y++)
+      for(int x = 0; x < img.width; x++)
+        if(img.px[y * img.width + x] == colors[p].second)
+          plane[y * stride + x / 8] |= 0x80 >> (x & 7);
+
+    e.source += format("static const uint8_t %s_p%zu[] = {", sym.c_str(), p) + bytes(plane) + "\n};\n\n";
+    e.blob.insert(e.blob.end(), plane.begin(), plane.end());
+    e.transfer += WINDOW_COST + plane.size();
+    e.flash += plane.size() + 8;
+  }
+
+  e.source += "static const MonoPlane " + sym + "_planes[] = {\n";
+  for(size_t p = 0; p < colors.size(); p++)
+    e.source += format("  {0x%04x, %s_p%zu},\n", colors[p].second, sym.c_str(), p);
+  e.source += "};\n\n";
+  e.source += format("const MonoIcon %s = {%d, %d, %zu, %s_planes};\n", sym.c_str(), img.width, img.height,
+    colors.size(), sym.c_str());
+  e.possible = true;
+  return e;
+}
+
+// Runs on a row join while the gap costs less than a window, rows join the rectangle
+// above while the padding does
+static std::vector<Rect> coverOpaque(const Image &img) {
+  std::vector<Rect> rects;
+  std::vector<size_t> open;
+
+  for(int y = 0; y < img.height; y++) {
+    std::vector<Rect> runs;
+    for(int x = 0; x < img.width; x++) {
+      if(img.px[y * img.width + x] == TRANSPARENT)
+        continue;
+
+      if(!runs.empty() && ((x - (runs.back().x + runs.back().w)) * 2 < WINDOW_COST))
+        runs.back().w = x - runs.back().x + 1;
+      else
+        runs.push_back({x, y, 1, 1});
+    }
+
+    std::vector<size_t> next;
+    for(const Rect &run : runs) {
+      bool joined = false;
+      for(size_t o : open) {
+        Rect &r = rects[o];
+        int x0 = std::min(r.x, run.x);
+        int x1 = std::max(r.x + r.w, run.x + run.w);
+        if((x0 >= run.x + run.w + WINDOW_COST / 2) || (x1 <= run.x - WINDOW_COST / 2))
+          continue;
+
+        int padding = (x1 - x0 - r.w) * r.h + (x1 - x0 - run.w);
+        if(padding * 2 < WINDOW_COST) {
+          r.x = x0;
+          r.w = x1 - x0;
+          r.h++;
+          next.push_back(o);
+          joined = true;
+          break;
+        }
+      }
+
+      if(!joined) {
+        rects.push_back(run);
+        next.push_back(rects.size() - 1);
+      }
+    }
+    open = next;
+  }
+
+  return rects;
+}
+
+static Encoded encodeSpan(const Image &img, const std::string &sym) {
+  Encoded e = {false, 0, 0, "", 0, {}};
+  if((img.width > 255) || (img.height > 255))
+    return e;
+
+  std::vector<Rect> rects = coverOpaque(img);
+  std::vector<uint8_t> pixels;
+  for(const Rect &r : rects) {
+    std::vector<uint8_t> p = rgb565(img, r.x, r.y, r.w, r.h);
+    pixels.insert(pixels.end(), p.begin(), p.end());
+    e.transfer += WINDOW_COST;
+  }
+  e.transfer += pixels.size();
+
+  // Dense bitmaps go out as one window, runCount 0
+  if(e.transfer >= WINDOW_COST + (size_t)img.width * img.height * 2) {
+    rects.clear();
+    pixels = rgb565(img, 0, 0, img.width, img.height);
+    e.transfer = WINDOW_COST + pixels.size();
+  }
+  e.flash = pixels.size() + rects.size() * 4;
+
+  for(const Rect &r : rects) {
+    e.blob.push_back(r.x);
+    e.blob.push_back(r.y);
+    e.blob.push_back(r.w);
+    e.blob.push_back(r.h);
+  }
+  e.blob.insert(e.blob.end(), pixels.begin(), pixels.end());
+  e.count = rects.size();
+
+  std::string runs = "NULL";
+  if(!rects.empty()) {
+    runs = sym + "_runs";
+    e.source = "static const SpanRun " + runs + "[] = {\n";
+    for(const Rect &r : rects)
+      e.source += format("  {%d, %d, %d, %d},\n", r.x, r.y, r.w, r.h);
+    e.source += "};\n\n";
+  }
+  e.source += "static const uint8_t " + sym + "_pixels[] = {" + bytes(pixels) + "\n};\n\n";
+  e.source += format("const SpanBitmap %s = {%d, %d, %zu, %s, %s_pixels};\n", sym.c_str(), img.width, img.height,
+    rects.size(), runs.c_str(), sym.c_str());
+  e.possible = true;
+  return e;
+}
+
+static std::string upper(const std::string &s) {
+  std::string u = s;
+  for(char &c : u)
+    c = toupper(c);
+  return u;
+}
+
+// The characters of the Layout.h labels from an 8x16 VGA font, close to the RA8875's
+// internal CGROM font the panels draw them in when the chrome is not baked
+struct ChromeGlyph {
+  char c;
+  uint8_t rows[16];
+};
+
+static const ChromeGlyph chromeFont[] = {
+  {' ', {0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00}},
+  {'G', {0x00, 0x00, 0x3c, 0x66, 0xc2, 0xc0, 0xc0, 0xde, 0xc6, 0xc6, 0x66, 0x3a, 0x00, 0x00, 0x00, 0x00}},
+  {'H', {0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xfe, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x00, 0x00, 0x00, 0x00}},
+  {'I', {0x00, 0x00, 0x3c, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00}},
+  {'L', {0x00, 0x00, 0xf0, 0x60, 0x60, 0x60, 0x60, 0x60, 0x60, 0x62, 0x66, 0xfe, 0x00, 0x00, 0x00, 0x00}},
+  {'O', {0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00}},
+  {'R', {0x00, 0x00, 0xfc, 0x66, 0x66, 0x66, 0x7c, 0x6c, 0x66, 0x66, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00}},
+  {'T', {0x00, 0x00, 0xff, 0xdb, 0x99, 0x18, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00}},
+  {'a', {0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x0c, 0x7c, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00}},
+  {'d', {0x00, 0x00, 0x1c, 0x0c, 0x0c, 0x3c, 0x6c, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00}},
+  {'e', {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xfe, 0xc0, 0xc0, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00}},
+  {'g', {0x00, 0x00, 0x00, 0x00, 0x00, 0x76, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x7c, 0x0c, 0xcc, 0x78, 0x00}},
+  {'h', {0x00, 0x00, 0xe0, 0x60, 0x60, 0x6c, 0x76, 0x66, 0x66, 0x66, 0x66, 0xe6, 0x00, 0x00, 0x00, 0x00}},
+  {'i', {0x00, 0x00, 0x18, 0x18, 0x00, 0x38, 0x18, 0x18, 0x18, 0x18, 0x18, 0x3c, 0x00, 0x00, 0x00, 0x00}},
+  {'m', {0x00, 0x00, 0x00, 0x00, 0x00, 0xec, 0xfe, 0xd6, 0xd6, 0xd6, 0xd6, 0xc6, 0x00, 0x00, 0x00, 0x00}},
+  {'n', {0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x66, 0x00, 0x00, 0x00, 0x00}},
+  {'o', {0x00, 0x00, 0x00, 0x00, 0x00, 0x7c, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7c, 0x00, 0x00, 0x00, 0x00}},
+  {'p', {0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x66, 0x66, 0x66, 0x66, 0x66, 0x7c, 0x60, 0x60, 0xf0, 0x00}},
+  {'r', {0x00, 0x00, 0x00, 0x00, 0x00, 0xdc, 0x76, 0x66, 0x60, 0x60, 0x60, 0xf0, 0x00, 0x00, 0x00, 0x00}},
+  {'t', {0x00, 0x00, 0x10, 0x30, 0x30, 0xfc, 0x30, 0x30, 0x30, 0x30, 0x36, 0x1c, 0x00, 0x00, 0x00, 0x00}},
+  {'u', {0x00, 0x00, 0x00, 0x00, 0x00, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0xcc, 0x76, 0x00, 0x00, 0x00, 0x00}},
+  {'w', {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xd6, 0xd6, 0xd6, 0xfe, 0x6c, 0x00, 0x00, 0x00, 0x00}},
+  {'y', {0x00, 0x00, 0x00, 0x00, 0x00, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0xc6, 0x7e, 0x06, 0x0c, 0xf8, 0x00}},
+};
+
+static void plot(Image *img, int x, int y, uint16_t color) {
+  if((x >= 0) && (y >= 0) && (x < img->width) && (y < img->height))
+    img->px[y * img->width + x] = color;
+}
+
+static void bakeLine(Image *img, int x0, int y0, int x1, int y1, uint16_t color) {
+  int dx = abs(x1 - x0), sx = (x0 < x1) ? 1 : -1;
+  int dy = -abs(y1 - y0), sy = (y0 < y1) ? 1 : -1;
+  int err = dx + dy;
+
+  for(;;) {
+    plot(img, x0, y0, color);
+    if((x0 == x1) && (y0 == y1))
+      break;
+    int e2 = 2 * err;
+    if(e2 >= dy) {
+      err += dy;
+      x0 += sx;
+    }
+    if(e2 <= dx) {
+      err += dx;
+      y0 += sy;
+    }
+  }
+}
+
+// One quadrant of a midpoint circle, part numbered as the RA8875 draws curves:
+// 0 lower left, 1 upper left, 2 upper right, 3 lower right
+static void bakeCurve(Image *img, int cx, int cy, int r, int part, uint16_t color) {
+  int sx = ((part == 2) || (part == 3)) ? 1 : -1;
+  int sy = ((part == 0) || (part == 3)) ? 1 : -1;
+  int x = r, y = 0, err = 1 - r;
+
+  while(x >= y) {
+    plot(img, cx + sx * x, cy + sy * y, color);
+    plot(img, cx + sx * y, cy + sy * x, color);
+    y++;
+    if(err < 0) {
+      err += 2 * y + 1;
+    } else {
+      x--;
+      err += 2 * (y - x) + 1;
+    }
+  }
+}
+
+static void bakeText(Image *img, int x, int y, const char *s, uint16_t color) {
+  for(; *s != 0; s++, x += 8) {
+    const ChromeGlyph *g = NULL;
+    for(const ChromeGlyph &c : chromeFont)
+      if(c.c == *s)
+        g = &c;
+    if(g == NULL) {
+      fprintf(stderr, "Warning: no chrome glyph for '%c'\n", *s);
+      continue;
+    }
+
+    for(int row = 0; row < 16; row++)
+      for(int col = 0; col < 8; col++)
+        if(g->rows[row] & (0x80 >> col))
+          plot(img, x + col, y + row, color);
+  }
+}
+
+// Everything drawChrome() would draw for every panel, both groups
+static void bakeChrome(Image *img) {
+  for(const LayoutPanel &panel : layoutPanels) {
+    for(int n = 0; n < panel.count; n++) {
+      const ChromeOp &op = panel.chrome[n];
+      if(((op.when == CHROME_INDOOR) && !panel.indoor) || ((op.when == CHROME_OUTDOOR) && panel.indoor))
+        continue;
+
+      int x = panel.x + op.x;
+      int y = panel.y + op.y;
+      switch(op.type) {
+        case CHROME_LINE:
+          bakeLine(img, x, y, panel.x + op.a, panel.y + op.b, op.color);
+          break;
+        case CHROME_CURVE:
+          bakeCurve(img, x, y, op.a, op.b, op.color);
+          break;
+        case CHROME_RECT:
+          bakeLine(img, x, y, x + op.a - 1, y, op.color);
+          bakeLine(img, x, y + op.b - 1, x + op.a - 1, y + op.b - 1, op.color);
+          bakeLine(img, x, y, x, y + op.b - 1, op.color);
+          bakeLine(img, x + op.a - 1, y, x + op.a - 1, y + op.b - 1, op.color);
+          break;
+        case CHROME_TEXT:
+          bakeText(img, x, y, op.text, op.color);
+          break;
+      }
+    }
+  }
+}
+
+// Crop each layoutTiles region out of the background, RGB565 high byte first
+static std::string encodeTiles(const Image &img, const std::string &name, size_t *flash) {
+  size_t count = sizeof(layoutTiles) / sizeof(layoutTiles[0]);
+  std::string s;
+  *flash = 0;
+
+  for(size_t n = 0; n < count; n++) {
+    const LayoutRegion &r = layoutTiles[n];
+    std::vector<uint8_t> px;
+    for(int y = r.y; y < r.y + r.h; y++) {
+      for(int x = r.x; x < r.x + r.w; x++) {
+        uint16_t c = img.px[y * img.width + x];
+        px.push_back(c >> 8);
+        px.push_back(c & 0xff);
+      }
+    }
+    *flash += px.size();
+    s += format("static const uint8_t %s_tile%zu[] = {", name.c_str(), n) + bytes(px) + "\n};\n\n";
+  }
+
+  s += format("const AssetTile %s_tiles[] = {\n", name.c_str());
+  for(size_t n = 0; n < count; n++) {
+    const LayoutRegion &r = layoutTiles[n];
+    s += format("  {%d, %d, %d, %d, %s_tile%zu},\n", r.x, r.y, r.w, r.h, name.c_str(), n);
+  }
+  s += "};\n";
+  return s;
+}
+
+struct Item {
+  std::string name;
+  int width;
+  int height;
+  int format;
+  uint8_t flags;
+  Encoded enc;
+  std::string tiles;      // C definition of <name>_tiles, empty without the option
+};
+
+// Encode every asset in the manifest and print the byte report
+static bool loadManifest(const char *manifest, std::vector<Item> &items) {
+  std::string path = manifest;
+  std::string dir = path.substr(0, path.find_last_of('/') + 1);
+  std::vector<uint8_t> text;
+  if(!readFile(path, text)) {
+    fprintf(stderr, "Could not read %s\n", manifest);
+    return false;
+  }
+  text.push_back(0);
+
+  fprintf(stderr, "%-12s %-7s %8s %8s %8s %8s  %s\n", "asset", "size", "raw", "rle", "mono", "span", "chosen");
+
+  char *line = strtok((char *)text.data(), "\n");
+  for(; line != NULL; line = strtok(NULL, "\n")) {
+    char file[128], name[64], enc[16], opt[16];
+    int used = 0;
+    if((line[0] == '#') || (sscanf(line, "%127s %63s %15s%n", file, name, enc, &used) < 3))
+      continue;
+
+    bool optional = false;
+    bool chrome = false;
+    bool tiles = false;
+    bool scaled = false;
+    int n;
+    for(const char *p = line + used; sscanf(p, "%15s%n", opt, &n) == 1; p += n) {
+      if(strcmp(opt, "optional") == 0) {
+        optional = true;
+      } else if(strcmp(opt, "chrome") == 0) {
+        chrome = true;
+      } else if(strcmp(opt, "tiles") == 0) {
+        tiles = true;
+      } else if(strcmp(opt, "scaled") == 0) {
+        scaled = true;
+      } else {
+        fprintf(stderr, "%s: unknown option %s\n", name, opt);
+        return false;
+      }
+    }
+
+    if(strlen(name) >= PACK_NAME_LEN) {
+      fprintf(stderr, "%s: names are at most %d characters\n", name, PACK_NAME_LEN - 1);
+      return false;
+    }
+
+    int want = -1;
+    for(int f = RAW; f <= AUTO; f++)
+      if(strcmp(enc, formatNames[f]) == 0)
+        want = f;
+    if(want < 0) {
+      fprintf(stderr, "%s: unknown encoding %s\n", name, enc);
+      return false;
+    }
+
+    Image img;
+    std::string error;
+    if(!readPng(dir + file, &img, &error)) {
+      if(optional && (error == "not found")) {
+        fprintf(stderr, "%-12s skipped, %s%s not in the tree\n", name, dir.c_str(), file);
+        continue;
+      }
+      fprintf(stderr, "%s%s: %s\n", dir.c_str(), file, error.c_str());
+      return false;
+    }
+
+    if((chrome || tiles) && ((img.width != SCREEN_WIDTH) || (img.height != SCREEN_HEIGHT))) {
+      fprintf(stderr, "%s: chrome and tiles need a %dx%d background\n", name, SCREEN_WIDTH, SCREEN_HEIGHT);
+      return false;
+    }
+    if(chrome)
+      bakeChrome(&img);
+    if(scaled)
+      scaleImage(&img);
+
+    Encoded enc4[4] = {
+      encodeRaw(img, std::string(name) + "_bmp"),
+      encodeRle(img, std::string(name) + "_rle"),
+      encodeMono(img, std::string(name) + "_mono"),
+      encodeSpan(img, std::string(name) + "_span")
+    };
+
+    int chosen = want;
+    if(want == AUTO) {
+      chosen = RAW;
+      for(int f = RLE; f <= SPAN; f++) {
+        if(!enc4[f].possible)
+          continue;
+        if((enc4[f].transfer < enc4[chosen].transfer) ||
+          ((enc4[f].transfer == enc4[chosen].transfer) && (enc4[f].flash < enc4[chosen].flash)))
+          chosen = f;
+      }
+    } else if(!enc4[want].possible) {
+      fprintf(stderr, "%s cannot be encoded as %s\n", name, enc);
+      return false;
+    }
+
+    std::string cells[4];
+    for(int f = RAW; f <= SPAN; f++)
+      cells[f] = enc4[f].possible ? format("%zu", enc4[f].transfer) : "-";
+    fprintf(stderr, "%-12s %3dx%-3d %8s %8s %8s %8s  %s, %zu bytes flash\n", name, img.width, img.height,
+      cells[RAW].c_str(), cells[RLE].c_str(), cells[MONO].c_str(), cells[SPAN].c_str(), formatNames[chosen],
+      enc4[chosen].flash);
+
+    Item item = {name, img.width, img.height, chosen, (uint8_t)(chrome ? FLAG_CHROME : 0), enc4[chosen], ""};
+    if(tiles) {
+      size_t flash;
+      item.tiles = encodeTiles(img, name, &flash);
+      fprintf(stderr, "%-12s %zu tiles, %zu bytes flash\n", "", sizeof(layoutTiles) / sizeof(layoutTiles[0]), flash);
+    }
+    items.push_back(item);
+  }
+
+  return true;
+}
+
+static bool writeFile(const char *name, const void *data, size_t len) {
+  FILE *f = fopen(name, "wb");
+  if((f == NULL) || (fwrite(data, 1, len, f) != len) || fclose(f)) {
+    fprintf(stderr, "Could not write %s\n", name);
+    return false;
+  }
+  return true;
+}
+
+static bool writeSources(const char *manifest, const std::vector<Item> &items, const char *cppName, const char *hName) {
+  static const char *types[] = {"const uint8_t", "const RleImage", "const MonoIcon", "const SpanBitmap"};
+  std::string cpp = format("// Generated by tools/assetgen.cpp from %s, do not edit\n", manifest);
+  std::string header = hName;
+  cpp += "#include <Arduino.h>\n#include \"" + header.substr(header.find_last_of('/') + 1) + "\"\n";
+  std::string h = cpp.substr(0, cpp.find('\n') + 1);
+  h += "#ifndef INCLUDE_BITMAPS_H_\n#define INCLUDE_BITMAPS_H_\n\n";
+  h += "#include <Arduino.h>\n#include \"rle.h\"\n#include \"monoicon.h\"\n#include \"spanbitmap.h\"\n\n";
+  h += "#define ASSET_RAW 0\n#define ASSET_RLE 1\n#define ASSET_MONO 2\n#define ASSET_SPAN 3\n\n";
+  h += "#define ASSET_FLAG_CHROME 0x01  // Panel borders and fixed labels (Layout.h) are in the image\n\n";
+  h += "struct Asset {\n  const char *name;       // Replaced by the asset pack entry of the same name\n"
+    "  uint8_t format;\n  uint8_t flags;\n  uint16_t width;\n  uint16_t height;\n  const void *data;\n};\n\n";
+  h += "struct AssetTile {      // Contiguous crop of a screen sized asset, RGB565 high byte first\n"
+    "  uint16_t x;\n  uint16_t y;\n  uint16_t w;\n  uint16_t h;\n  const uint8_t *data;\n};\n";
+
+  for(const Item &item : items) {
+    const char *name = item.name.c_str();
+    std::string sym = item.name + "_" + formatSuffix[item.format];
+    cpp += "\n" + item.enc.source;
+    cpp += format("\nconst Asset %s_asset = {\"%s\", %s, %s, %d, %d, &%s%s};\n", name, name, formatTags[item.format],
+      (item.flags & FLAG_CHROME) ? "ASSET_FLAG_CHROME" : "0", item.width, item.height, sym.c_str(),
+      (item.format == RAW) ? "[0]" : "");
+
+    std::string macro = "ASSET_" + upper(item.name);
+    h += format("\n#define %s_WIDTH %d\n#define %s_HEIGHT %d\n#define %s_FORMAT %s\n", macro.c_str(), item.width,
+      macro.c_str(), item.height, macro.c_str(), formatTags[item.format]);
+    h += format("extern %s %s%s;\nextern const Asset %s_asset;\n", types[item.format], sym.c_str(),
+      (item.format == RAW) ? "[]" : "", name);
+
+    if(!item.tiles.empty()) {
+      cpp += "\n" + item.tiles;
+      h += format("#define %s_TILES %zu\nextern const AssetTile %s_tiles[];\n", macro.c_str(),
+        sizeof(layoutTiles) / sizeof(layoutTiles[0]), name);
+    }
+  }
+
+  h += "\n#endif /* INCLUDE_BITMAPS_H_ */\n";
+
+  return writeFile(cppName, cpp.data(), cpp.size()) && writeFile(hName, h.data(), h.size());
+}
+
+// Header, entry table, then each asset's data on a 4 byte boundary, all little endian
+static bool writePack(const std::vector<Item> &items, const char *binName) {
+  std::vector<uint8_t> data;
+  std::vector<uint8_t> table;
+  uint32_t base = PACK_HEADER_SIZE + PACK_ENTRY_SIZE * items.size();
+
+  for(const Item &item : items) {
+    char name[PACK_NAME_LEN] = {0};
+    strncpy(name, item.name.c_str(), PACK_NAME_LEN - 1);
+    table.insert(table.end(), name, name + PACK_NAME_LEN);
+    table.push_back(item.format);
+    table.push_back(item.flags);
+    put16(table, item.width);
+    put16(table, item.height);
+    put16(table, item.enc.count);
+    put32(table, base + data.size());
+    put32(table, item.enc.blob.size());
+
+    data.insert(data.end(), item.enc.blob.begin(), item.enc.blob.end());
+    while(data.size() & 3)
+      data.push_back(0);
+  }
+
+  std::vector<uint8_t> pack;
+  put32(pack, PACK_MAGIC);
+  put16(pack, PACK_VERSION);
+  put16(pack, items.size());
+  put32(pack, base + data.size());
+  put32(pack, 0);
+  pack.insert(pack.end(), table.begin(), table.end());
+  pack.insert(pack.end(), data.begin(), data.end());
+
+  fprintf(stderr, "Pack %s: %zu assets, %zu bytes\n", binName, items.size(), pack.size());
+  return writeFile(binName, pack.data(), pack.size());
+}
+
+int main(int argc, char **argv) {
+  std::vector<Item> items;
+
+  if((argc == 4) && (strcmp(argv[1], "--pack") == 0)) {
+    if(!loadManifest(argv[2], items) || !writePack(items, argv[3]))
+      return 1;
+    return 0;
+  }
+
+  if(argc != 4) {
+    fprintf(stderr, "Usage: %s <assets.txt> <out.cpp> <out.h>\n", argv[0]);
+    fprintf(stderr, "       %s --pack <assets.txt> <out.bin>\n", argv[0]);
+    return 1;
+  }
+
+  if(!loadManifest(argv[1], items) || !writeSources(argv[1], items, argv[2], argv[3]))
+    return 1;
+
+  return 0;
+}
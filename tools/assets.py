@@ -0,0 +1,75 @@
+#
+# PlatformIO pre-build script for the asset pipeline.  Builds tools/assetgen.cpp with the
+# host compiler and regenerates src/bitmaps.cpp and include/bitmaps.h from assets/assets.txt
+# whenever the manifest, a PNG or the tool (or Layout.h, built into it) is newer than the
+# generated files.  The byte report printed by assetgen shows what each encoding would
+# cost to draw.  A -DLAYOUT_480x272 build compiles the tool for that layout and takes its
+# assets from assets/assets-480x272.txt, a change of layout always regenerates.  The value
+# glyph atlas of the layout is regenerated the same way from tools/glyphgen.cpp.
+#
+import os
+import subprocess
+
+Import("env")
+
+project = env.subst("$PROJECT_DIR")
+build = env.subst("$PROJECT_BUILD_DIR")
+
+source = os.path.join(project, "tools", "assetgen.cpp")
+layout = os.path.join(project, "include", "Layout.h")    # Chrome baked into the background
+small = any("LAYOUT_480x272" in str(f) for f in list(env.get("BUILD_FLAGS", [])) + list(env.get("CPPDEFINES", [])))
+layout_flags = ["-DLAYOUT_480x272"] if small else []
+manifest_name = "assets-480x272.txt" if layout_flags else "assets.txt"
+manifest = os.path.join(project, "assets", manifest_name)
+outputs = [os.path.join(project, "src", "bitmaps.cpp"), os.path.join(project, "include", "bitmaps.h")]
+tool = os.path.join(build, "assetgen-480x272" if small else "assetgen")
+
+
+def mtime(path):
+    return os.path.getmtime(path) if os.path.exists(path) else 0
+
+
+def run(args):
+    if subprocess.call(args, cwd=project) != 0:
+        env.Exit(1)
+
+
+if not os.path.isdir(build):
+    os.makedirs(build)
+
+if max(mtime(source), mtime(layout)) > mtime(tool):
+    print("Building assetgen")
+    run([os.environ.get("HOST_CXX", "c++"), "-O2"] + layout_flags + ["-o", tool, source])
+
+
+def generated_from(path):
+    if not os.path.exists(path):
+        return None
+    with open(path) as f:
+        return f.readline()
+
+
+# The outputs are shared by both layouts, their first line names the manifest they came
+# from, so switching layout regenerates them even when they look newer than the inputs
+layout_changed = any("from assets/" + manifest_name + "," not in (generated_from(f) or "") for f in outputs)
+
+inputs = [manifest, tool] + [os.path.join(project, "assets", f) for f in os.listdir(os.path.join(project, "assets"))]
+if layout_changed or max(mtime(f) for f in inputs) > min(mtime(f) for f in outputs):
+    print("Generating assets")
+    run([tool, "assets/" + manifest_name, "src/bitmaps.cpp", "include/bitmaps.h"])
+
+# The atlases of both layouts sit in src/, each only compiles for its own cell height
+glyph_source = os.path.join(project, "tools", "glyphgen.cpp")
+glyph_tool = os.path.join(build, "glyphgen-480x272" if small else "glyphgen")
+glyph_output = os.path.join(project, "src", "glyphs-480x272.cpp" if small else "glyphs.cpp")
+
+if max(mtime(glyph_source), mtime(layout)) > mtime(glyph_tool):
+    print("Building glyphgen")
+    run([os.environ.get("HOST_CXX", "c++"), "-O2"] + layout_flags + ["-o", glyph_tool, glyph_source])
+
+if mtime(glyph_tool) > mtime(glyph_output):
+    print("Generating glyphs")
+    with open(glyph_output + ".tmp", "w") as out:
+        if subprocess.call([glyph_tool], cwd=project, stdout=out) != 0:
+            env.Exit(1)
+    os.replace(glyph_output + ".tmp", glyph_output)
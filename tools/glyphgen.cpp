@@ -0,0 +1,169 @@
+/**
+ *  @filename   :   glyphgen.cpp
+ *  @brief      :   ESP32 Ecowitt Weather Station Console, host tool generating the value glyph atlas
+ *
+ *  @author     :   Kevin Kessler
+ *
+ * Copyright (C) 2024 Kevin Kessler
+ *
+ *    This program is free software: you can redistribute it and/or modify
+ *    it under the terms of the GNU General Public License as published by
+ *    the Free Software Foundation, either version 3 of the License, or
+ *    (at your option) any later version.
+ *
+ *    This program is distributed in the hope that it will be useful,
+ *    but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *    MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *    GNU General Public License for more details.
+ *
+ *    You should have received a copy of the GNU General Public License
+ *    along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *  Build on the host:  c++ -O2 -o glyphgen tools/glyphgen.cpp
+ *  Usage:              glyphgen > src/glyphs.cpp
+ *  For 480x272:        c++ -O2 -DLAYOUT_480x272 -o glyphgen tools/glyphgen.cpp
+ *                      glyphgen > src/glyphs-480x272.cpp
+ *
+ *  Run by tools/assets.py before every PlatformIO build for the layout being built,
+ *  whenever the tool or Layout.h changed.
+ *
+ *  The glyphs are stroked outlines drawn in a 64 pixel cell with the baseline at row 54,
+ *  the CGROM Arial at textEnlarge(1), and scaled to the VALUE_CELL_HEIGHT of the layout
+ *  (Layout.h).  They are rasterized with 8x8 supersampling into 4 bit coverage.  Only the
+ *  characters the panels print as values are generated.  The output only compiles for
+ *  the cell height it was made for, so both files can sit in src/.
+ */
+
+#include <cstdio>
+#include <cmath>
+#include <vector>
+#include "../include/Layout.h"
+
+#define DESIGN_HEIGHT 64    // The outlines below
+#define CELL_HEIGHT VALUE_CELL_HEIGHT
+#define SCALE ((double)DESIGN_HEIGHT / CELL_HEIGHT)
+#define SUPERSAMPLE 8
+#define STROKE 2.9          // Half the stroke width, in design pixels
+
+// Digit box
+#define L 5.0
+#define R 31.0
+#define T 9.0
+#define B 54.0
+
+struct Point {
+  double x;
+  double y;
+};
+
+struct Glyph {
+  char c;
+  int advance;
+  std::vector<std::vector<Point> > strokes;
+};
+
+static std::vector<Point> line(double x0, double y0, double x1, double y1) {
+  return { {x0, y0}, {x1, y1} };
+}
+
+// Elliptical arc, angles in degrees counter clockwise from the right with y pointing down
+static std::vector<Point> arc(double cx, double cy, double rx, double ry, double a0, double a1) {
+  std::vector<Point> p;
+  int steps = 48;
+  for(int n = 0; n <= steps; n++) {
+    double a = (a0 + (a1 - a0) * n / steps) * M_PI / 180.0;
+    p.push_back({cx + rx * cos(a), cy - ry * sin(a)});
+  }
+  return p;
+}
+
+static std::vector<Glyph> buildGlyphs() {
+  std::vector<Glyph> g;
+  double M = (T + B) / 2;
+
+  g.push_back({'0', 36, { arc(18, M, 12, (B - T) / 2, 0, 360) }});
+  g.push_back({'1', 36, { line(21, T, 21, B), line(11, 17, 21, T) }});
+  g.push_back({'2', 36, { arc(18, 20, 12, 11, 160, -30), line(28.4, 25.5, 6, B), line(6, B, R, B) }});
+  g.push_back({'3', 36, { arc(18, 20, 11, 10.5, 150, -90), arc(18, 42, 12.5, 11.5, 90, -150) }});
+  g.push_back({'4', 36, { line(26, B, 26, T), line(26, T, L, 40), line(L, 40, 32, 40) }});
+  g.push_back({'5', 36, { line(29, T, 10, T), line(10, T, 8, 30), arc(18, 40, 12.5, 13.5, 125, -140) }});
+  g.push_back({'6', 36, { arc(18, 40, 12, 13.5, 0, 360), arc(18, M, 12, (B - T) / 2, 200, 50) }});
+  g.push_back({'7', 36, { line(6, T, R, T), line(R, T, 15, B) }});
+  g.push_back({'8', 36, { arc(18, 20, 10.5, 10.5, 0, 360), arc(18, 42, 12.5, 12, 0, 360) }});
+  g.push_back({'9', 36, { arc(18, 23, 12, 13.5, 0, 360), arc(18, M, 12, (B - T) / 2, 20, -130) }});
+  g.push_back({'.', 18, { { {9, B - 3}, {9, B - 3} } }});
+  g.push_back({'-', 22, { line(4, 38, 18, 38) }});
+  g.push_back({'%', 54, { arc(12, 18, 7, 8.5, 0, 360), arc(40, 45, 7, 8.5, 0, 360), line(42, T, 10, B) }});
+  g.push_back({'"', 22, { line(6, T, 6, 20), line(14, T, 14, 20) }});
+  g.push_back({' ', 18, { }});
+
+  return g;
+}
+
+static double segmentDistance(double px, double py, const Point &a, const Point &b) {
+  double dx = b.x - a.x;
+  double dy = b.y - a.y;
+  double len = dx * dx + dy * dy;
+  double t = 0;
+  if(len > 0) {
+    t = ((px - a.x) * dx + (py - a.y) * dy) / len;
+    t = t < 0 ? 0 : (t > 1 ? 1 : t);
+  }
+  double ex = a.x + t * dx - px;
+  double ey = a.y + t * dy - py;
+  return sqrt(ex * ex + ey * ey);
+}
+
+static bool inked(const Glyph &g, double x, double y) {
+  for(const std::vector<Point> &s : g.strokes) {
+    if(s.size() == 1)
+      continue;
+    for(size_t n = 0; n + 1 < s.size(); n++)
+      if(segmentDistance(x, y, s[n], s[n + 1]) <= STROKE)
+        return true;
+  }
+  return false;
+}
+
+int main() {
+  std::vector<Glyph> glyphs = buildGlyphs();
+  std::vector<unsigned char> data;
+  std::vector<size_t> offsets;
+
+  for(Glyph &g : glyphs) {
+    offsets.push_back(data.size());
+    g.advance = g.advance * CELL_HEIGHT / DESIGN_HEIGHT;
+    int stride = (g.advance + 1) / 2;
+
+    for(int y = 0; y < CELL_HEIGHT; y++) {
+      std::vector<unsigned char> row(stride, 0);
+      for(int x = 0; x < g.advance; x++) {
+        int hits = 0;
+        for(int sy = 0; sy < SUPERSAMPLE; sy++)
+          for(int sx = 0; sx < SUPERSAMPLE; sx++)
+            if(inked(g, (x + (sx + 0.5) / SUPERSAMPLE) * SCALE, (y + (sy + 0.5) / SUPERSAMPLE) * SCALE))
+              hits++;
+
+        int alpha = (hits * 15 + (SUPERSAMPLE * SUPERSAMPLE) / 2) / (SUPERSAMPLE * SUPERSAMPLE);
+        row[x / 2] |= (x & 1) ? alpha : (alpha << 4);
+      }
+      data.insert(data.end(), row.begin(), row.end());
+    }
+  }
+
+  printf("// Generated by tools/glyphgen.cpp, do not edit\n");
+  printf("#include <Arduino.h>\n#include \"glyphs.h\"\n\n#if GLYPH_HEIGHT == %d\n\n", CELL_HEIGHT);
+
+  printf("const uint8_t glyph_alpha[] = {");
+  for(size_t n = 0; n < data.size(); n++)
+    printf("%s0x%02x", (n == 0) ? "\n  " : (n % 20) ? ", " : ",\n  ", data[n]);
+  printf("\n};\n\n");
+
+  printf("const GlyphInfo glyph_info[GLYPH_COUNT] = {\n");
+  for(size_t n = 0; n < glyphs.size(); n++)
+    printf("  {'%s%c', %d, %zu},\n", glyphs[n].c == '"' ? "\\" : "", glyphs[n].c, glyphs[n].advance, offsets[n]);
+  printf("};\n\n#endif\n");
+
+  fprintf(stderr, "%zu glyphs, %zu bytes of 4 bit alpha\n", glyphs.size(), data.size());
+  return 0;
+}